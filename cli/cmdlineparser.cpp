@@ -117,6 +117,10 @@ bool CmdLineParser::parseFromArgs(int argc, const char* const argv[])
     bool def = false;
     bool maxconfigs = false;
 
+    // libraries are loaded when all options are known, so the cache dir is set.
+    // The flag tells if the library was requested by the user or is needed by a Visual Studio project.
+    std::vector<std::pair<std::string, bool> > libraries;
+
     for (int i = 1; i < argc; i++) {
         if (argv[i][0] == '-') {
             if (std::strcmp(argv[i], "--version") == 0) {
@@ -143,6 +147,10 @@ bool CmdLineParser::parseFromArgs(int argc, const char* const argv[])
             else if (std::strcmp(argv[i], "--debug-warnings") == 0)
                 mSettings->debugwarnings = true;
 
+            // Verify fused token simplifications
+            else if (std::strcmp(argv[i], "--debug-peephole") == 0)
+                mSettings->debugPeephole = true;
+
             // dump cppcheck data
             else if (std::strcmp(argv[i], "--dump") == 0)
                 mSettings->dump = true;
@@ -497,21 +505,15 @@ bool CmdLineParser::parseFromArgs(int argc, const char* const argv[])
 
             // --library
             else if (std::strncmp(argv[i], "--library=", 10) == 0) {
-                if (!CppCheckExecutor::tryLoadLibrary(mSettings->library, argv[0], argv[i]+10))
-                    return false;
+                libraries.emplace_back(argv[i]+10, true);
             }
 
             // --project
             else if (std::strncmp(argv[i], "--project=", 10) == 0) {
                 const std::string projectFile = argv[i]+10;
                 const ImportProject::Type projType = mSettings->project.import(projectFile);
-                if (projType == ImportProject::VS_SLN || projType == ImportProject::VS_VCXPROJ) {
-                    if (!CppCheckExecutor::tryLoadLibrary(mSettings->library, argv[0], "windows.cfg")) {
-                        // This shouldn't happen normally.
-                        printMessage("cppcheck: Failed to load 'windows.cfg'. Your Cppcheck installation is broken. Please re-install.");
-                        return false;
-                    }
-                }
+                if (projType == ImportProject::VS_SLN || projType == ImportProject::VS_VCXPROJ)
+                    libraries.emplace_back("windows.cfg", false);
                 if (projType == ImportProject::MISSING) {
                     printMessage("cppcheck: Failed to open project '" + projectFile + "'.");
                     return false;
@@ -780,6 +782,48 @@ bool CmdLineParser::parseFromArgs(int argc, const char* const argv[])
                 maxconfigs = true;
             }
 
+            // Threads used for the analysis of one file
+            else if (std::strncmp(argv[i], "--threads=", 10) == 0) {
+                std::istringstream iss(10+argv[i]);
+                if (!(iss >> mSettings->threads)) {
+                    printMessage("cppcheck: argument to '--threads=' is not a number.");
+                    return false;
+                }
+
+                if (mSettings->threads < 1 || mSettings->threads > 256) {
+                    printMessage("cppcheck: argument to '--threads=' must be between 1 and 256.");
+                    return false;
+                }
+            }
+
+            // Maximum number of ValueFlow values per token
+            else if (std::strncmp(argv[i], "--valueflow-max-values=", 23) == 0) {
+                std::istringstream iss(23+argv[i]);
+                if (!(iss >> mSettings->valueFlowMaxValues)) {
+                    printMessage("cppcheck: argument to '--valueflow-max-values=' is not a number.");
+                    return false;
+                }
+
+                if (mSettings->valueFlowMaxValues < 1) {
+                    printMessage("cppcheck: argument to '--valueflow-max-values=' must be greater than 0.");
+                    return false;
+                }
+            }
+
+            // Maximum number of ValueFlow values passed into the parameters of a function
+            else if (std::strncmp(argv[i], "--valueflow-max-function-values=", 32) == 0) {
+                std::istringstream iss(32+argv[i]);
+                if (!(iss >> mSettings->valueFlowMaxFunctionValues)) {
+                    printMessage("cppcheck: argument to '--valueflow-max-function-values=' is not a number.");
+                    return false;
+                }
+
+                if (mSettings->valueFlowMaxFunctionValues < 1) {
+                    printMessage("cppcheck: argument to '--valueflow-max-function-values=' must be greater than 0.");
+                    return false;
+                }
+            }
+
             // Print help
             else if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0) {
                 mPathNames.clear();
@@ -804,6 +848,18 @@ bool CmdLineParser::parseFromArgs(int argc, const char* const argv[])
         }
     }
 
+    mSettings->library.setCacheDir(mSettings->buildDir);
+    for (const std::pair<std::string, bool> &library : libraries) {
+        // tryLoadLibrary() reports why the library could not be loaded
+        if (!CppCheckExecutor::tryLoadLibrary(mSettings->library, argv[0], library.first.c_str())) {
+            if (!library.second) {
+                // This shouldn't happen normally.
+                printMessage("cppcheck: Failed to load '" + library.first + "'. Your Cppcheck installation is broken. Please re-install.");
+            }
+            return false;
+        }
+    }
+
     mSettings->project.ignorePaths(mIgnoredPaths);
 
     if (mSettings->force)
@@ -853,6 +909,7 @@ void CmdLineParser::printHelp()
               "                         Analysis output directory. Useful for various data.\n"
               "                         Some possible usages are; whole program analysis,\n"
               "                         incremental analysis, distributed analysis.\n"
+              "                         Loaded library files are cached in the directory.\n"
               "    --check-config       Check cppcheck configuration. The normal code\n"
               "                         analysis is disabled by this flag.\n"
               "    --check-library      Show information messages when library files have\n"
@@ -1074,6 +1131,16 @@ void CmdLineParser::printHelp()
               "                           \\r         insert carriage return\n"
               "                         Example format (gcc-like):\n"
               "                         '{file}:{line}:{column}: note: {info}\\n{code}'\n"
+              "    --threads=<n>        Use <n> threads for the analysis of each file. The\n"
+              "                         result is the same as with one thread. Default is 1.\n"
+              "    --valueflow-max-function-values=<n>\n"
+              "                         Maximum number of values that are passed from function\n"
+              "                         calls into the parameters of one function. Default is\n"
+              "                         1000.\n"
+              "    --valueflow-max-values=<n>\n"
+              "                         Maximum number of values per token. Further values are\n"
+              "                         dropped. Default is 10.\n"
+              "                         Use --debug-warnings to see where the limit is hit.\n"
               "    -v, --verbose        Output more detailed error information.\n"
               "    --version            Print out version number.\n"
               "    --xml                Write results in xml format to error stream (stderr).\n"
@@ -41,6 +41,8 @@
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <map>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -293,7 +295,7 @@ static void print_stacktrace(FILE* output, bool demangling, int maxdepth, bool l
 #endif
 }
 
-static const size_t MYSTACKSIZE = 16*1024+SIGSTKSZ; // wild guess about a reasonable buffer
+static const size_t MYSTACKSIZE = 16*1024+32768; // wild guess about a reasonable buffer
 static char mytstack[MYSTACKSIZE]= {0}; // alternative stack for signal handler
 static bool bStackBelowHeap=false; // lame attempt to locate heap vs. stack address space. See CppCheckExecutor::check_wrapper()
 
@@ -850,7 +852,10 @@ int CppCheckExecutor::check_internal(CppCheck& cppcheck, int /*argc*/, const cha
         std::list<std::string> fileNames;
         for (std::map<std::string, std::size_t>::const_iterator i = _files.begin(); i != _files.end(); ++i)
             fileNames.push_back(i->first);
-        AnalyzerInformation::writeFilesTxt(settings.buildDir, fileNames, settings.project.fileSettings);
+        AnalyzerInformation::compact(settings.buildDir, fileNames, settings.project.fileSettings);
+
+        // Load the function summaries of all translation units that have been analyzed before
+        AnalyzerInformation::loadSummaries(settings.buildDir, &settings.summaries);
     }
 
     unsigned int returnValue = 0;
@@ -452,7 +452,7 @@ void MainWindow::doAnalyzeProject(ImportProject p, const bool checkLibrary, cons
 
     if (!checkSettings.buildDir.empty()) {
         std::list<std::string> sourcefiles;
-        AnalyzerInformation::writeFilesTxt(checkSettings.buildDir, sourcefiles, p.fileSettings);
+        AnalyzerInformation::compact(checkSettings.buildDir, sourcefiles, p.fileSettings);
     }
 
     //mThread->SetanalyzeProject(true);
@@ -519,7 +519,7 @@ void MainWindow::doAnalyzeFiles(const QStringList &files, const bool checkLibrar
         std::list<std::string> sourcefiles;
         foreach (QString s, fileNames)
             sourcefiles.push_back(s.toStdString());
-        AnalyzerInformation::writeFilesTxt(checkSettings.buildDir, sourcefiles, checkSettings.project.fileSettings);
+        AnalyzerInformation::compact(checkSettings.buildDir, sourcefiles, checkSettings.project.fileSettings);
     }
 
     mThread->setCheckFiles(true);
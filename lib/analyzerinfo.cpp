@@ -19,143 +19,618 @@
 #include "analyzerinfo.h"
 
 #include "path.h"
+#include "summaries.h"
 #include "utils.h"
 
-#include <tinyxml2.h>
-#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <set>
 #include <sstream>
 
-AnalyzerInformation::~AnalyzerInformation()
+/*
+ * The information of a TU starts with a fixed size header:
+ *  - magic string "cppcheck-a1\n"
+ *  - format, 4 bytes
+ *  - checksum, 8 bytes
+ * and then a sequence of records: type (1 byte), size (4 bytes) and data.
+ *
+ * analyzerinfo.dat is a sequence of entries: size (4 bytes), source file
+ * and cfg as strings, and the information of the TU.
+ *
+ * analyzerinfo.idx is the magic string "cppcheck-i1\n" and the hash and
+ * offset (8 bytes each) of all entries in analyzerinfo.dat, sorted by
+ * hash.
+ *
+ * Numbers are little endian, strings are a size (4 bytes) and the characters.
+ */
+static const std::string analyzerInfoMagic("cppcheck-a1\n");
+static const unsigned int analyzerInfoFormat = 3;
+static const std::string indexMagic("cppcheck-i1\n");
+
+static const char storeFile[] = "/analyzerinfo.dat";
+static const char indexFile[] = "/analyzerinfo.idx";
+static const char lockFile[] = "/analyzerinfo.lock";
+
+enum RecordType { DEPENDENCIES_RECORD = 1, ERROR_RECORD = 2, FILEINFO_RECORD = 3, SUMMARIES_RECORD = 4, USED_SUMMARIES_RECORD = 5 };
+
+static void writeNumber(std::string *data, unsigned long long value, int bytes)
 {
-    close();
+    for (int i = 0; i < bytes; ++i)
+        data->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
 }
 
-static std::string getFilename(const std::string &fullpath)
+static unsigned long long readNumber(const char *data, int bytes)
 {
-    std::string::size_type pos1 = fullpath.find_last_of("/\\");
-    pos1 = (pos1 == std::string::npos) ? 0U : (pos1 + 1U);
-    std::string::size_type pos2 = fullpath.rfind('.');
-    if (pos2 < pos1)
-        pos2 = std::string::npos;
-    if (pos2 != std::string::npos)
-        pos2 = pos2 - pos1;
-    return fullpath.substr(pos1,pos2);
+    unsigned long long value = 0;
+    for (int i = 0; i < bytes; ++i)
+        value |= static_cast<unsigned long long>(static_cast<unsigned char>(data[i])) << (8 * i);
+    return value;
 }
 
-void AnalyzerInformation::writeFilesTxt(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<ImportProject::FileSettings> &fileSettings)
+static void writeString(std::string *data, const std::string &s)
 {
-    std::map<std::string, unsigned int> fileCount;
+    writeNumber(data, s.size(), 4);
+    *data += s;
+}
 
-    const std::string filesTxt(buildDir + "/files.txt");
-    std::ofstream fout(filesTxt);
-    for (const std::string &f : sourcefiles) {
-        const std::string afile = getFilename(f);
-        if (fileCount.find(afile) == fileCount.end())
-            fileCount[afile] = 0;
-        fout << afile << ".a" << (++fileCount[afile]) << "::" << Path::fromNativeSeparators(f) << '\n';
+static bool readString(const std::string &data, std::string::size_type *pos, std::string *s)
+{
+    if (data.size() - *pos < 4)
+        return false;
+    const std::string::size_type size = readNumber(data.data() + *pos, 4);
+    *pos += 4;
+    if (data.size() - *pos < size)
+        return false;
+    s->assign(data, *pos, size);
+    *pos += size;
+    return true;
+}
+
+static void writeRecord(std::string *ostr, RecordType type, const std::string &data)
+{
+    ostr->push_back(static_cast<char>(type));
+    writeNumber(ostr, data.size(), 4);
+    *ostr += data;
+}
+
+static bool readHeader(std::istream &istr, unsigned long long *checksum)
+{
+    char header[24];
+    if (!istr.read(header, sizeof(header)))
+        return false;
+    if (analyzerInfoMagic.compare(0, analyzerInfoMagic.size(), header, 12) != 0)
+        return false;
+    if (readNumber(header + 12, 4) != analyzerInfoFormat)
+        return false;
+    *checksum = readNumber(header + 16, 8);
+    return true;
+}
+
+/** Number of bytes from the read position to the end of the stream */
+static unsigned long long bytesLeft(std::istream &istr)
+{
+    const std::streamoff pos = istr.tellg();
+    if (pos < 0)
+        return 0;
+    istr.seekg(0, std::ios::end);
+    const std::streamoff end = istr.tellg();
+    istr.seekg(pos);
+    return (end < pos) ? 0 : static_cast<unsigned long long>(end - pos);
+}
+
+static bool readRecord(std::istream &istr, RecordType *type, std::string *data)
+{
+    char header[5];
+    if (!istr.read(header, sizeof(header)))
+        return false;
+    *type = static_cast<RecordType>(static_cast<unsigned char>(header[0]));
+    // the size is not trusted, the data may be truncated or corrupt
+    const unsigned long long size = readNumber(header + 1, 4);
+    if (size > bytesLeft(istr))
+        return false;
+    data->resize(size);
+    return data->empty() || istr.read(&(*data)[0], data->size());
+}
+
+/** Are the summaries of the functions that the TU calls the same as when it was analyzed? */
+static bool usedSummariesUnchanged(const std::string &data, const Summaries &summaries)
+{
+    std::string::size_type pos = 0;
+    std::string usedSummaries;
+    if (!readString(data, &pos, &usedSummaries))
+        return false;
+    std::set<std::string> functionNames;
+    std::string functionName;
+    while (pos < data.size()) {
+        if (!readString(data, &pos, &functionName))
+            return false;
+        functionNames.insert(functionName);
     }
+    return summaries.getSummaries(functionNames) == usedSummaries;
+}
 
-    for (const ImportProject::FileSettings &fs : fileSettings) {
-        const std::string afile = getFilename(fs.filename);
-        if (fileCount.find(afile) == fileCount.end())
-            fileCount[afile] = 0;
-        fout << afile << ".a" << (++fileCount[afile]) << ":" << fs.cfg << ":" << Path::fromNativeSeparators(fs.filename) << std::endl;
+/**
+ * Read the error records that follow the header. The errors can't be
+ * used if the summaries of the called functions have changed or if an
+ * error can't be read, then the TU is analyzed again.
+ */
+static bool readErrors(std::istream &istr, const Summaries &summaries, std::list<ErrorLogger::ErrorMessage> *errors)
+{
+    std::list<ErrorLogger::ErrorMessage> results;
+    RecordType type;
+    std::string data;
+    while (readRecord(istr, &type, &data)) {
+        if (type == ERROR_RECORD) {
+            results.emplace_back();
+            try {
+                results.back().deserialize(data);
+            } catch (const InternalError &) {
+                return false;
+            }
+        } else if (type == USED_SUMMARIES_RECORD && !usedSummariesUnchanged(data, summaries)) {
+            return false;
+        }
     }
+    errors->splice(errors->end(), results);
+    return true;
 }
 
-void AnalyzerInformation::close()
+namespace {
+    /** @brief An entry in analyzerinfo.dat */
+    struct Entry {
+        std::string sourcefile;
+        std::string cfg;
+        std::string data;
+    };
+
+    /**
+     * @brief Lock the files in the build dir. The TUs are analyzed by
+     * threads or by processes, so both a mutex and a file lock are used.
+     */
+    class StoreLock {
+    public:
+        explicit StoreLock(const std::string &buildDir) : mLock(mMutex) {
+#ifndef _WIN32
+            mFd = open((buildDir + lockFile).c_str(), O_RDWR | O_CREAT, 0644);
+            if (mFd >= 0)
+                flock(mFd, LOCK_EX);
+#else
+            (void)buildDir;
+#endif
+        }
+        ~StoreLock() {
+#ifndef _WIN32
+            if (mFd >= 0)
+                ::close(mFd);
+#endif
+        }
+    private:
+        static std::mutex mMutex;
+        std::lock_guard<std::mutex> mLock;
+#ifndef _WIN32
+        int mFd;
+#endif
+    };
+
+    std::mutex StoreLock::mMutex;
+}
+
+static unsigned long long hashEntry(const std::string &sourcefile, const std::string &cfg)
 {
-    mAnalyzerInfoFile.clear();
-    if (mOutputStream.is_open()) {
-        mOutputStream << "</analyzerinfo>\n";
-        mOutputStream.close();
+    // FNV-1a, the hash must be the same in all cppcheck builds that share a build dir
+    unsigned long long h = 14695981039346656037ULL;
+    const std::string key = cfg + '\0' + sourcefile;
+    for (const char c : key) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
     }
+    return h;
+}
+
+static void writeEntry(std::string *store, const Entry &entry)
+{
+    std::string data;
+    writeString(&data, entry.sourcefile);
+    writeString(&data, entry.cfg);
+    data += entry.data;
+    writeNumber(store, data.size(), 4);
+    *store += data;
 }
 
-static bool skipAnalysis(const std::string &analyzerInfoFile, unsigned long long checksum, std::list<ErrorLogger::ErrorMessage> *errors)
+static bool readEntry(std::istream &istr, unsigned long long storeSize, Entry *entry)
 {
-    tinyxml2::XMLDocument doc;
-    const tinyxml2::XMLError error = doc.LoadFile(analyzerInfoFile.c_str());
-    if (error != tinyxml2::XML_SUCCESS)
+    char size[4];
+    if (!istr.read(size, sizeof(size)))
         return false;
+    // the size is not trusted, the store may be truncated or an index may be stale
+    const unsigned long long dataSize = readNumber(size, 4);
+    const std::streamoff pos = istr.tellg();
+    if (pos < 0 || dataSize > storeSize - std::min(storeSize, static_cast<unsigned long long>(pos)))
+        return false;
+    std::string data(dataSize, '\0');
+    if (!data.empty() && !istr.read(&data[0], data.size()))
+        return false;
+    std::string::size_type dataPos = 0;
+    if (!readString(data, &dataPos, &entry->sourcefile) || !readString(data, &dataPos, &entry->cfg))
+        return false;
+    entry->data = data.substr(dataPos);
+    return true;
+}
 
-    const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
-    if (rootNode == nullptr)
+/**
+ * Call f for the last entry of each TU. The offsets of the entries are
+ * found first so only one entry is in memory at a time. The store must
+ * be locked.
+ */
+static void readStore(const std::string &buildDir, const std::function<void(const Entry &)> &f)
+{
+    std::ifstream fin(buildDir + storeFile, std::ios::binary);
+    const unsigned long long storeSize = bytesLeft(fin);
+    std::map<std::pair<std::string, std::string>, unsigned long long> offsets;
+    Entry entry;
+    for (;;) {
+        const std::streamoff offset = fin.tellg();
+        if (offset < 0 || !readEntry(fin, storeSize, &entry))
+            break;
+        offsets[std::make_pair(entry.sourcefile, entry.cfg)] = static_cast<unsigned long long>(offset);
+    }
+
+    fin.clear();
+    for (std::map<std::pair<std::string, std::string>, unsigned long long>::const_iterator it = offsets.begin(); it != offsets.end(); ++it) {
+        fin.seekg(it->second);
+        if (readEntry(fin, storeSize, &entry))
+            f(entry);
+    }
+}
+
+/** Look up the entry of a TU in the index */
+static bool findEntry(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::string *data)
+{
+    const StoreLock lock(buildDir);
+
+    std::ifstream index(buildDir + indexFile, std::ios::binary);
+    char magic[12];
+    if (!index.read(magic, sizeof(magic)) || indexMagic.compare(0, indexMagic.size(), magic, sizeof(magic)) != 0)
         return false;
+    index.seekg(0, std::ios::end);
+    const unsigned long long count = (static_cast<unsigned long long>(index.tellg()) - sizeof(magic)) / 16U;
+
+    // binary search for the first entry with the hash
+    const unsigned long long hash = hashEntry(sourcefile, cfg);
+    char item[16];
+    unsigned long long first = 0, last = count;
+    while (first < last) {
+        const unsigned long long middle = first + (last - first) / 2U;
+        index.seekg(sizeof(magic) + middle * 16U);
+        if (!index.read(item, sizeof(item)))
+            return false;
+        if (readNumber(item, 8) < hash)
+            first = middle + 1U;
+        else
+            last = middle;
+    }
+
+    std::ifstream store(buildDir + storeFile, std::ios::binary);
+    const unsigned long long storeSize = bytesLeft(store);
+    index.seekg(sizeof(magic) + first * 16U);
+    while (index.read(item, sizeof(item)) && readNumber(item, 8) == hash) {
+        Entry entry;
+        store.seekg(readNumber(item + 8, 8));
+        if (readEntry(store, storeSize, &entry) && entry.sourcefile == sourcefile && entry.cfg == cfg) {
+            data->swap(entry.data);
+            return true;
+        }
+        store.clear();
+    }
+    return false;
+}
+
+/** Replace a file in the build dir with a temporary file. The store must be locked. */
+static void renameFile(const std::string &tempfile, const std::string &filename)
+{
+    if (std::rename(tempfile.c_str(), filename.c_str()) != 0) {
+        std::remove(filename.c_str());
+        std::rename(tempfile.c_str(), filename.c_str());
+    }
+}
+
+/** Replace a file in the build dir. The store must be locked. */
+static void replaceFile(const std::string &filename, const std::string &data)
+{
+    const std::string tempfile = filename + ".tmp";
+    {
+        std::ofstream fout(tempfile, std::ios::binary);
+        if (!fout.is_open())
+            return;
+        fout << data;
+    }
+    renameFile(tempfile, filename);
+}
 
-    const char *attr = rootNode->Attribute("checksum");
-    if (!attr || attr != std::to_string(checksum))
+AnalyzerInformation::AnalyzerInformation() : mOpen(false)
+{
+}
+
+AnalyzerInformation::~AnalyzerInformation()
+{
+    close();
+}
+
+void AnalyzerInformation::compact(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<ImportProject::FileSettings> &fileSettings)
+{
+    // the TUs are identified as in CppCheck::check()
+    std::set<std::pair<std::string, std::string> > translationUnits;
+    for (const std::string &f : sourcefiles)
+        translationUnits.insert(std::make_pair(Path::simplifyPath(f), emptyString));
+    for (const ImportProject::FileSettings &fs : fileSettings)
+        translationUnits.insert(std::make_pair(Path::simplifyPath(fs.filename), fs.cfg));
+
+    const StoreLock lock(buildDir);
+
+    // the entries are copied to the new store one at a time
+    const std::string tempfile = buildDir + storeFile + ".tmp";
+    std::vector<std::pair<unsigned long long, unsigned long long> > offsets;
+    {
+        std::ofstream fout(tempfile, std::ios::binary);
+        if (!fout.is_open())
+            return;
+        unsigned long long storeSize = 0;
+        std::string data;
+        readStore(buildDir, [&](const Entry &entry) {
+            if (translationUnits.find(std::make_pair(entry.sourcefile, entry.cfg)) == translationUnits.end())
+                return;
+            offsets.emplace_back(hashEntry(entry.sourcefile, entry.cfg), storeSize);
+            data.clear();
+            writeEntry(&data, entry);
+            fout << data;
+            storeSize += data.size();
+        });
+    }
+    renameFile(tempfile, buildDir + storeFile);
+    std::sort(offsets.begin(), offsets.end());
+
+    std::string index(indexMagic);
+    for (const std::pair<unsigned long long, unsigned long long> &offset : offsets) {
+        writeNumber(&index, offset.first, 8);
+        writeNumber(&index, offset.second, 8);
+    }
+
+    replaceFile(buildDir + indexFile, index);
+}
+
+void AnalyzerInformation::close()
+{
+    if (!mOpen)
+        return;
+    mOpen = false;
+
+    Entry entry;
+    entry.sourcefile.swap(mSourcefile);
+    entry.cfg.swap(mCfg);
+    entry.data.swap(mData);
+    std::string data;
+    writeEntry(&data, entry);
+
+    const StoreLock lock(mBuildDir);
+    std::ofstream fout(mBuildDir + storeFile, std::ios::binary | std::ios::app);
+    fout << data;
+}
+
+static bool skipAnalysis(const std::string &data, unsigned long long checksum, const Summaries &summaries, std::list<ErrorLogger::ErrorMessage> *errors)
+{
+    std::istringstream istr(data);
+    unsigned long long oldChecksum;
+    if (!readHeader(istr, &oldChecksum) || oldChecksum != checksum)
+        return false;
+
+    return readErrors(istr, summaries, errors);
+}
+
+static std::string hashSettings(const std::string &settings)
+{
+    return std::to_string(std::hash<std::string>()(settings));
+}
+
+/** size, modification time and status change time of a file, empty if it does not exist */
+static std::string getFileStamp(const std::string &filename)
+{
+    struct stat file_stat;
+    if (stat(filename.c_str(), &file_stat) != 0)
+        return emptyString;
+    std::string stamp = std::to_string(file_stat.st_size) + ':' + std::to_string(file_stat.st_mtime);
+    // files written within the same second only differ in the nanoseconds
+#if defined(__APPLE__)
+    stamp += '.' + std::to_string(file_stat.st_mtimespec.tv_nsec);
+#elif !defined(_WIN32)
+    stamp += '.' + std::to_string(file_stat.st_mtim.tv_nsec);
+#endif
+    // the status change time can not be set back by tools that restore the modification time
+    return stamp + ':' + std::to_string(file_stat.st_ctime);
+}
+
+static bool dependenciesUnchanged(const std::string &dependencies, const std::string &sourcefile, const std::string &settings)
+{
+    std::string::size_type pos = 0;
+    std::string s;
+    if (!readString(dependencies, &pos, &s) || s != hashSettings(settings))
         return false;
 
-    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-        if (std::strcmp(e->Name(), "error") == 0)
-            errors->emplace_back(e);
+    // the first file is the source file
+    bool first = true;
+    std::string stamp;
+    while (pos < dependencies.size()) {
+        if (!readString(dependencies, &pos, &s) || !readString(dependencies, &pos, &stamp))
+            return false;
+        if (first && s != sourcefile)
+            return false;
+        if (getFileStamp(s) != stamp)
+            return false;
+        first = false;
     }
+    return !first;
+}
 
-    return true;
+bool AnalyzerInformation::isUnchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, const std::string &settings, const Summaries &summaries, std::list<ErrorLogger::ErrorMessage> *errors)
+{
+    if (buildDir.empty() || sourcefile.empty())
+        return false;
+
+    std::string entry;
+    if (!findEntry(buildDir, sourcefile, cfg, &entry))
+        return false;
+
+    std::istringstream istr(entry);
+    unsigned long long checksum;
+    if (!readHeader(istr, &checksum))
+        return false;
+
+    // the dependencies are written before anything else
+    RecordType type;
+    std::string data;
+    if (!readRecord(istr, &type, &data) || type != DEPENDENCIES_RECORD || !dependenciesUnchanged(data, sourcefile, settings))
+        return false;
+
+    return readErrors(istr, summaries, errors);
 }
 
-std::string AnalyzerInformation::getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg)
+void AnalyzerInformation::getFileInfo(const std::string &buildDir, std::list<FileInfo> *fileInfo)
 {
-    const std::string files(buildDir + "/files.txt");
-    std::ifstream fin(files);
-    if (fin.is_open()) {
-        std::string line;
-        const std::string endsWith(':' + cfg + ':' + sourcefile);
-        while (std::getline(fin,line)) {
-            if (line.size() <= endsWith.size() + 2U)
+    const StoreLock lock(buildDir);
+    readStore(buildDir, [&](const Entry &entry) {
+        std::istringstream istr(entry.data);
+        unsigned long long checksum;
+        if (!readHeader(istr, &checksum))
+            return;
+        RecordType type;
+        std::string data;
+        while (readRecord(istr, &type, &data)) {
+            if (type != FILEINFO_RECORD)
                 continue;
-            if (line.compare(line.size()-endsWith.size(), endsWith.size(), endsWith) != 0)
+            std::string::size_type pos = 0;
+            FileInfo info;
+            if (!readString(data, &pos, &info.check))
                 continue;
-            std::ostringstream ostr;
-            ostr << buildDir << '/' << line.substr(0,line.find(':'));
-            return ostr.str();
+            info.sourcefile = entry.sourcefile;
+            info.data = data.substr(pos);
+            fileInfo->push_back(info);
         }
-    }
+    });
+}
+
+void AnalyzerInformation::loadSummaries(const std::string &buildDir, Summaries *summaries)
+{
+    const StoreLock lock(buildDir);
+    readStore(buildDir, [&](const Entry &entry) {
+        std::istringstream istr(entry.data);
+        unsigned long long checksum;
+        if (!readHeader(istr, &checksum))
+            return;
+        RecordType type;
+        std::string data;
+        while (readRecord(istr, &type, &data)) {
+            if (type == SUMMARIES_RECORD)
+                summaries->setSummaries(getTranslationUnit(entry.sourcefile, entry.cfg), data);
+        }
+    });
+}
+
+std::string AnalyzerInformation::getTranslationUnit(const std::string &sourcefile, const std::string &cfg)
+{
+    return cfg.empty() ? sourcefile : (sourcefile + ':' + cfg);
+}
 
+std::string AnalyzerInformation::getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg)
+{
     std::string filename = Path::fromNativeSeparators(buildDir);
     if (!endsWith(filename, '/'))
         filename += '/';
-    const std::string::size_type pos = sourcefile.rfind('/');
+    const std::string::size_type pos = sourcefile.find_last_of("/\\");
     if (pos == std::string::npos)
         filename += sourcefile;
     else
         filename += sourcefile.substr(pos+1);
-    filename += ".analyzerinfo";
-    return filename;
+    std::ostringstream ostr;
+    ostr << filename << '.' << std::hex << hashEntry(sourcefile, cfg);
+    return ostr.str();
 }
 
-bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, unsigned long long checksum, std::list<ErrorLogger::ErrorMessage> *errors)
+bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, unsigned long long checksum, const Summaries &summaries, std::list<ErrorLogger::ErrorMessage> *errors)
 {
     if (buildDir.empty() || sourcefile.empty())
         return true;
     close();
 
-    mAnalyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg);
-
-    if (skipAnalysis(mAnalyzerInfoFile, checksum, errors))
+    std::string entry;
+    if (findEntry(buildDir, sourcefile, cfg, &entry) && skipAnalysis(entry, checksum, summaries, errors))
         return false;
 
-    mOutputStream.open(mAnalyzerInfoFile);
-    if (mOutputStream.is_open()) {
-        mOutputStream << "<?xml version=\"1.0\"?>\n";
-        mOutputStream << "<analyzerinfo checksum=\"" << checksum << "\">\n";
-    } else {
-        mAnalyzerInfoFile.clear();
-    }
+    mBuildDir = buildDir;
+    mSourcefile = sourcefile;
+    mCfg = cfg;
+    mData = analyzerInfoMagic;
+    writeNumber(&mData, analyzerInfoFormat, 4);
+    writeNumber(&mData, checksum, 8);
+    mOpen = true;
 
     return true;
 }
 
+void AnalyzerInformation::setDependencies(const std::string &settings, const std::vector<std::string> &files)
+{
+    if (!mOpen)
+        return;
+
+    std::string data;
+    writeString(&data, hashSettings(settings));
+    for (const std::string &file : files) {
+        const std::string stamp = getFileStamp(file);
+        if (stamp.empty())
+            return; // can't tell if the file changes
+        writeString(&data, file);
+        writeString(&data, stamp);
+    }
+    writeRecord(&mData, DEPENDENCIES_RECORD, data);
+}
+
 void AnalyzerInformation::reportErr(const ErrorLogger::ErrorMessage &msg, bool /*verbose*/)
 {
-    if (mOutputStream.is_open())
-        mOutputStream << msg.toXML() << '\n';
+    if (mOpen)
+        writeRecord(&mData, ERROR_RECORD, msg.serialize());
 }
 
 void AnalyzerInformation::setFileInfo(const std::string &check, const std::string &fileInfo)
 {
-    if (mOutputStream.is_open() && !fileInfo.empty())
-        mOutputStream << "  <FileInfo check=\"" << check << "\">\n" << fileInfo << "  </FileInfo>\n";
+    if (mOpen && !fileInfo.empty()) {
+        std::string data;
+        writeString(&data, check);
+        writeRecord(&mData, FILEINFO_RECORD, data + fileInfo);
+    }
+}
+
+void AnalyzerInformation::setSummaries(const std::string &summaries)
+{
+    if (mOpen)
+        writeRecord(&mData, SUMMARIES_RECORD, summaries);
+}
+
+void AnalyzerInformation::setUsedSummaries(const std::set<std::string> &functionNames, const Summaries &summaries)
+{
+    if (!mOpen)
+        return;
+    std::string data;
+    writeString(&data, summaries.getSummaries(functionNames));
+    for (const std::string &functionName : functionNames)
+        writeString(&data, functionName);
+    writeRecord(&mData, USED_SUMMARIES_RECORD, data);
 }
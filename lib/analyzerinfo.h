@@ -25,9 +25,12 @@
 #include "errorlogger.h"
 #include "importproject.h"
 
-#include <fstream>
 #include <list>
+#include <set>
 #include <string>
+#include <vector>
+
+class Summaries;
 
 /// @addtogroup Core
 /// @{
@@ -39,27 +42,91 @@
 * - checksum
 * - error messages
 * - whole program analysis data
+* - included files and the settings they were loaded with
+* - function summaries
 *
 * The information can be used for various purposes. It allows:
 * - 'make' - only analyze TUs that are changed and generate full report
 * - should be possible to add distributed analysis later
 * - multi-threaded whole program analysis
+*
+* The information of all TUs is stored in the file analyzerinfo.dat in
+* the build dir. The information of a TU is appended when it has been
+* analyzed, the last entry of a TU is the valid one. compact() removes
+* the old entries and writes the index analyzerinfo.idx that is used to
+* look up the entries. Entries that are appended after that are only
+* seen by the whole program analysis and by the next compact().
 */
 class CPPCHECKLIB AnalyzerInformation {
 public:
+    AnalyzerInformation();
     ~AnalyzerInformation();
 
-    static void writeFilesTxt(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<ImportProject::FileSettings> &fileSettings);
+    /** whole program analysis data that a check has saved for a TU, see setFileInfo() */
+    struct FileInfo {
+        std::string sourcefile;
+        std::string check;
+        std::string data;
+    };
 
-    /** Close current TU.analyzerinfo file */
+    /**
+     * Remove old entries and entries of TUs that are not analyzed anymore
+     * from the build dir and write the index. This is done before the
+     * files are analyzed.
+     */
+    static void compact(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<ImportProject::FileSettings> &fileSettings);
+
+    /** Store the information of the current TU in the build dir */
     void close();
-    bool analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, unsigned long long checksum, std::list<ErrorLogger::ErrorMessage> *errors);
+
+    /**
+     * Start to record the information of a TU. If it was analyzed before
+     * with the same checksum and the summaries of the functions it calls
+     * are unchanged, the errors of that analysis are returned instead.
+     * @return false if the TU does not need to be analyzed
+     */
+    bool analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, unsigned long long checksum, const Summaries &summaries, std::list<ErrorLogger::ErrorMessage> *errors);
+
+    /**
+     * Can the file be skipped without preprocessing it? That is the case
+     * if it was analyzed with the same settings and the size and
+     * modification time of the file and all files it includes are the
+     * same as then, and the summaries of the functions it calls have not
+     * changed.
+     * @param errors the errors of the last analysis
+     */
+    static bool isUnchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, const std::string &settings, const Summaries &summaries, std::list<ErrorLogger::ErrorMessage> *errors);
+
+    /** Record the file and the files it includes, see isUnchanged() */
+    void setDependencies(const std::string &settings, const std::vector<std::string> &files);
     void reportErr(const ErrorLogger::ErrorMessage &msg, bool verbose);
     void setFileInfo(const std::string &check, const std::string &fileInfo);
+
+    /** Record the function summaries of the TU, see Summaries::create() */
+    void setSummaries(const std::string &summaries);
+
+    /** Record the summaries of the functions that the TU calls, the results are not used when they change */
+    void setUsedSummaries(const std::set<std::string> &functionNames, const Summaries &summaries);
+
+    /** Get the data that was given to setFileInfo() for all TUs in the build dir */
+    static void getFileInfo(const std::string &buildDir, std::list<FileInfo> *fileInfo);
+
+    /** Load the function summaries of all TUs in the build dir */
+    static void loadSummaries(const std::string &buildDir, Summaries *summaries);
+
+    /** Name that identifies a TU in the summaries */
+    static std::string getTranslationUnit(const std::string &sourcefile, const std::string &cfg);
+
+    /** Path of a file in the build dir for other data of a TU, for instance a dump file */
     static std::string getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg);
 private:
-    std::ofstream mOutputStream;
-    std::string mAnalyzerInfoFile;
+    std::string mBuildDir;
+    std::string mSourcefile;
+    std::string mCfg;
+
+    /** header and records of the current TU */
+    std::string mData;
+    bool mOpen;
 };
 
 /// @}
@@ -585,9 +585,9 @@ bool isUniqueExpression(const Token* tok)
         const Type * varType = var->type();
         // Iterate over the variables in scope and the parameters of the function if possible
         const Function * fun = scope->function;
-        const std::list<Variable>* setOfVars[] = {&scope->varlist, fun ? &fun->argumentList : nullptr};
+        const ChunkedList<Variable>* setOfVars[] = {&scope->varlist, fun ? &fun->argumentList : nullptr};
         if (varType) {
-            for (const std::list<Variable>* vars:setOfVars) {
+            for (const ChunkedList<Variable>* vars:setOfVars) {
                 if (!vars)
                     continue;
                 for (const Variable& v:*vars) {
@@ -597,7 +597,7 @@ bool isUniqueExpression(const Token* tok)
                 }
             }
         } else {
-            for (const std::list<Variable>* vars:setOfVars) {
+            for (const ChunkedList<Variable>* vars:setOfVars) {
                 if (!vars)
                     continue;
                 for (const Variable& v:*vars) {
@@ -719,7 +719,7 @@ bool isVariableChangedByFunctionCall(const Token *tok, const Settings *settings,
         const unsigned int argCount = numberOfArguments(tok);
         const Scope *typeScope = tok->variable()->typeScope();
         if (typeScope) {
-            for (std::list<Function>::const_iterator it = typeScope->functionList.begin(); it != typeScope->functionList.end(); ++it) {
+            for (ChunkedList<Function>::const_iterator it = typeScope->functionList.begin(); it != typeScope->functionList.end(); ++it) {
                 if (!it->isConstructor() || it->argCount() < argCount)
                     continue;
                 const Variable *arg = it->getArgumentVar(argnr);
@@ -833,6 +833,19 @@ std::vector<const Token *> getArguments(const Token *ftok)
     return arguments;
 }
 
+const Token *skipCasts(const Token *tok)
+{
+    while (tok) {
+        if (tok->str() == "(" && tok->isCast())
+            tok = tok->link()->next();
+        else if (Token::Match(tok, "static_cast|reinterpret_cast|const_cast|dynamic_cast <") && Token::simpleMatch(tok->linkAt(1), "> ("))
+            tok = tok->linkAt(1)->tokAt(2);
+        else
+            break;
+    }
+    return tok;
+}
+
 const Token *findLambdaEndToken(const Token *first)
 {
     if (!first || first->str() != "[")
@@ -127,6 +127,15 @@ std::vector<const Token *> getArguments(const Token *ftok);
  */
 const Token *findLambdaEndToken(const Token *first);
 
+/**
+ * skip casts in the token list
+ *   (char *)&x       => &x
+ *   static_cast<int*>(malloc(n)) => malloc(n)
+ * \param tok The first token of the expression
+ * \return the first token after the casts
+ */
+const Token *skipCasts(const Token *tok);
+
 /**
  * do we see a likely write of rhs through overloaded operator
  *   s >> x;
@@ -20,6 +20,8 @@
 
 #include "check.h"
 
+#include "symboldatabase.h"
+
 #include <iostream>
 
 //---------------------------------------------------------------------------
@@ -66,3 +68,52 @@ std::list<Check *> &Check::instances()
     return _instances;
 #endif
 }
+
+void TokenVisitor::walk(const Tokenizer *tokenizer, const std::vector<TokenVisitor *> &visitors)
+{
+    std::vector<TokenVisitor *> tokenVisitors, callVisitors, scopeVisitors;
+    for (TokenVisitor *visitor : visitors) {
+        if (visitor->events() & TOKEN)
+            tokenVisitors.push_back(visitor);
+        if (visitor->events() & FUNCTION_CALL)
+            callVisitors.push_back(visitor);
+        if (visitor->events() & SCOPE)
+            scopeVisitors.push_back(visitor);
+    }
+
+    std::vector<const Scope *> scopes;
+    for (const Scope *functionScope : tokenizer->getSymbolDatabase()->functionScopes) {
+        // nested functions are walked together with the enclosing function
+        bool nested = false;
+        for (const Scope *scope = functionScope->nestedIn; scope && !nested; scope = scope->nestedIn)
+            nested = scope->isExecutable();
+        if (nested)
+            continue;
+
+        for (const Token *tok = functionScope->bodyStart; tok; tok = tok->next()) {
+            if (tok->str() == "{" && tok->scope()->bodyStart == tok) {
+                scopes.push_back(tok->scope());
+                for (TokenVisitor *visitor : scopeVisitors)
+                    visitor->enterScope(tok->scope());
+            }
+
+            if (tok != functionScope->bodyStart && tok != functionScope->bodyEnd) {
+                for (TokenVisitor *visitor : tokenVisitors)
+                    visitor->visitToken(tok);
+                if (!callVisitors.empty() && tok->isName() && !tok->isControlFlowKeyword() && tok->strAt(1) == "(") {
+                    for (TokenVisitor *visitor : callVisitors)
+                        visitor->visitFunctionCall(tok);
+                }
+            }
+
+            if (tok->str() == "}" && !scopes.empty() && scopes.back()->bodyEnd == tok) {
+                for (TokenVisitor *visitor : scopeVisitors)
+                    visitor->leaveScope(scopes.back());
+                scopes.pop_back();
+            }
+
+            if (tok == functionScope->bodyEnd)
+                break;
+        }
+    }
+}
@@ -30,6 +30,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 namespace tinyxml2 {
     class XMLElement;
@@ -41,6 +42,45 @@ namespace tinyxml2 {
 /// @addtogroup Core
 /// @{
 
+/**
+ * @brief Interface for checks that are run in a common walk of the
+ * function bodies, see Check::createTokenVisitor(). The tokens are only
+ * walked once for all these checks.
+ */
+class CPPCHECKLIB TokenVisitor {
+public:
+    /** Events that a visitor can subscribe to */
+    enum Event {
+        TOKEN = 1 << 0,         ///< visitToken() is called for each token in the function bodies
+        FUNCTION_CALL = 1 << 1, ///< visitFunctionCall() is called for each name that is followed by "(" and is not a control flow keyword
+        SCOPE = 1 << 2          ///< enterScope() and leaveScope() are called for the function scopes and the scopes in them
+    };
+
+    virtual ~TokenVisitor() {}
+
+    /** Event flags that the visitor subscribes to */
+    virtual unsigned int events() const = 0;
+
+    virtual void enterScope(const Scope * /*scope*/) {
+    }
+
+    virtual void leaveScope(const Scope * /*scope*/) {
+    }
+
+    virtual void visitToken(const Token * /*tok*/) {
+    }
+
+    virtual void visitFunctionCall(const Token * /*tok*/) {
+    }
+
+    /**
+     * Walk the function bodies once and send the events to the visitors.
+     * Functions that are nested in other functions are walked together
+     * with the enclosing function.
+     */
+    static void walk(const Tokenizer *tokenizer, const std::vector<TokenVisitor *> &visitors);
+};
+
 /**
  * @brief Interface class that cppcheck uses to communicate with the checks.
  * All checking classes must inherit from this class
@@ -67,8 +107,37 @@ public:
     virtual void runChecks(const Tokenizer *, const Settings *, ErrorLogger *) {
     }
 
-    /** run checks, the token list is simplified */
-    virtual void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) = 0;
+    /**
+     * Create a visitor that performs the check in the common walk of the
+     * function bodies. When a visitor is returned cppcheck doesn't call
+     * runChecks(). The caller deletes the visitor.
+     */
+    virtual TokenVisitor * createTokenVisitor(const Tokenizer * /*tokenizer*/, const Settings * /*settings*/, ErrorLogger * /*errorLogger*/) const {
+        return nullptr;
+    }
+
+    /**
+     * Can runChecks() run at the same time as the other checks? A check
+     * that changes data that other checks read must return false, then it
+     * is run after the other checks are finished.
+     */
+    virtual bool isThreadSafe() const {
+        return true;
+    }
+
+    /** ValueFlow analyses (ValueFlow::Analysis flags) that the check uses */
+    virtual unsigned int valueFlowAnalyses() const {
+        return 0;
+    }
+
+    /**
+     * Names of which at least one must be used in the code for the check
+     * to report anything. Files that don't use any of them are not
+     * checked. If the list is empty the check is always run.
+     */
+    virtual std::vector<std::string> triggerNames(const Settings * /*settings*/) const {
+        return std::vector<std::string>();
+    }
 
     /** get error messages */
     virtual void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const = 0;
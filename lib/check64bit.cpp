@@ -46,74 +46,78 @@ void Check64BitPortability::pointerassignment()
     if (!mSettings->isEnabled(Settings::PORTABILITY))
         return;
 
-    const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
-
-    // Check return values
-    for (const Scope * scope : symbolDatabase->functionScopes) {
-        if (scope->function == nullptr || !scope->function->hasBody()) // We only look for functions with a body
-            continue;
+    TokenVisitor::walk(mTokenizer, std::vector<TokenVisitor *>(1, this));
+}
 
-        bool retPointer = false;
-        if (scope->function->token->strAt(-1) == "*") // Function returns a pointer
-            retPointer = true;
+void Check64BitPortability::enterScope(const Scope *scope)
+{
+    if (scope->type == Scope::eLambda) {
+        mReturnChecks.push_back(NO_RETURN_CHECK);
+    } else if (scope->type == Scope::eFunction) {
+        // We only look for functions with a body
+        if (scope->function == nullptr || !scope->function->hasBody())
+            mReturnChecks.push_back(NO_RETURN_CHECK);
+        else if (scope->function->token->strAt(-1) == "*") // Function returns a pointer
+            mReturnChecks.push_back(RETURN_POINTER);
         else if (Token::Match(scope->function->token->previous(), "int|long|DWORD")) // Function returns an integer
-            ;
+            mReturnChecks.push_back(RETURN_INTEGER);
         else
-            continue;
+            mReturnChecks.push_back(NO_RETURN_CHECK);
+    }
+}
 
-        for (const Token* tok = scope->bodyStart->next(); tok != scope->bodyEnd; tok = tok->next()) {
-            // skip nested functions
-            if (tok->str() == "{") {
-                if (tok->scope()->type == Scope::ScopeType::eFunction || tok->scope()->type == Scope::ScopeType::eLambda)
-                    tok = tok->link();
-            }
+void Check64BitPortability::leaveScope(const Scope *scope)
+{
+    if (scope->type == Scope::eLambda || scope->type == Scope::eFunction)
+        mReturnChecks.pop_back();
+}
+
+void Check64BitPortability::visitToken(const Token *tok)
+{
+    // Check return values
+    if (tok->str() == "return") {
+        if (mReturnChecks.empty() || mReturnChecks.back() == NO_RETURN_CHECK)
+            return;
 
-            if (tok->str() != "return")
-                continue;
+        if (!tok->astOperand1() || tok->astOperand1()->isNumber())
+            return;
 
-            if (!tok->astOperand1() || tok->astOperand1()->isNumber())
-                continue;
+        const ValueType * const returnType = tok->astOperand1()->valueType();
+        if (!returnType)
+            return;
 
-            const ValueType * const returnType = tok->astOperand1()->valueType();
-            if (!returnType)
-                continue;
+        const bool retPointer = (mReturnChecks.back() == RETURN_POINTER);
 
-            if (retPointer && !returnType->typeScope && returnType->pointer == 0U)
-                returnIntegerError(tok);
+        if (retPointer && !returnType->typeScope && returnType->pointer == 0U)
+            returnIntegerError(tok);
 
-            if (!retPointer && returnType->pointer >= 1U)
-                returnPointerError(tok);
-        }
+        if (!retPointer && returnType->pointer >= 1U)
+            returnPointerError(tok);
     }
 
     // Check assignments
-    for (const Scope * scope : symbolDatabase->functionScopes) {
-        for (const Token *tok = scope->bodyStart; tok && tok != scope->bodyEnd; tok = tok->next()) {
-            if (tok->str() != "=")
-                continue;
-
-            const ValueType *lhstype = tok->astOperand1() ? tok->astOperand1()->valueType() : nullptr;
-            const ValueType *rhstype = tok->astOperand2() ? tok->astOperand2()->valueType() : nullptr;
-            if (!lhstype || !rhstype)
-                continue;
-
-            // Assign integer to pointer..
-            if (lhstype->pointer >= 1U &&
-                !tok->astOperand2()->isNumber() &&
-                rhstype->pointer == 0U &&
-                rhstype->originalTypeName.empty() &&
-                rhstype->type == ValueType::Type::INT)
-                assignmentIntegerToAddressError(tok);
-
-            // Assign pointer to integer..
-            if (rhstype->pointer >= 1U &&
-                lhstype->pointer == 0U &&
-                lhstype->originalTypeName.empty() &&
-                lhstype->isIntegral() &&
-                lhstype->type >= ValueType::Type::CHAR &&
-                lhstype->type <= ValueType::Type::INT)
-                assignmentAddressToIntegerError(tok);
-        }
+    else if (tok->str() == "=") {
+        const ValueType *lhstype = tok->astOperand1() ? tok->astOperand1()->valueType() : nullptr;
+        const ValueType *rhstype = tok->astOperand2() ? tok->astOperand2()->valueType() : nullptr;
+        if (!lhstype || !rhstype)
+            return;
+
+        // Assign integer to pointer..
+        if (lhstype->pointer >= 1U &&
+            !tok->astOperand2()->isNumber() &&
+            rhstype->pointer == 0U &&
+            rhstype->originalTypeName.empty() &&
+            rhstype->type == ValueType::Type::INT)
+            assignmentIntegerToAddressError(tok);
+
+        // Assign pointer to integer..
+        if (rhstype->pointer >= 1U &&
+            lhstype->pointer == 0U &&
+            lhstype->originalTypeName.empty() &&
+            lhstype->isIntegral() &&
+            lhstype->type >= ValueType::Type::CHAR &&
+            lhstype->type <= ValueType::Type::INT)
+            assignmentAddressToIntegerError(tok);
     }
 }
 
@@ -26,8 +26,10 @@
 #include "config.h"
 
 #include <string>
+#include <vector>
 
 class ErrorLogger;
+class Scope;
 class Settings;
 class Token;
 class Tokenizer;
@@ -40,7 +42,7 @@ class Tokenizer;
  * @brief Check for 64-bit portability issues
  */
 
-class CPPCHECKLIB Check64BitPortability : public Check {
+class CPPCHECKLIB Check64BitPortability : public Check, private TokenVisitor {
 public:
     /** This constructor is used when registering the Check64BitPortability */
     Check64BitPortability() : Check(myName()) {
@@ -57,17 +59,29 @@ public:
         check64BitPortability.pointerassignment();
     }
 
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        (void)tokenizer;
-        (void)settings;
-        (void)errorLogger;
+    TokenVisitor * createTokenVisitor(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) const override {
+        if (!settings->isEnabled(Settings::PORTABILITY))
+            return nullptr;
+        return new Check64BitPortability(tokenizer, settings, errorLogger);
     }
 
     /** Check for pointer assignment */
     void pointerassignment();
 
 private:
+    /** What is checked in the return statements of a function */
+    enum ReturnCheck { NO_RETURN_CHECK, RETURN_POINTER, RETURN_INTEGER };
+
+    unsigned int events() const override {
+        return TOKEN | SCOPE;
+    }
+
+    void enterScope(const Scope *scope) override;
+    void leaveScope(const Scope *scope) override;
+    void visitToken(const Token *tok) override;
+
+    /** Return checks of the functions and lambdas that are walked */
+    std::vector<ReturnCheck> mReturnChecks;
 
     void assignmentAddressToIntegerError(const Token *tok);
     void assignmentIntegerToAddressError(const Token *tok);
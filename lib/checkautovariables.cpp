@@ -32,7 +32,7 @@
 #include "valueflow.h"
 
 #include <cstddef>
-#include <list>
+#include <vector>
 
 //---------------------------------------------------------------------------
 
@@ -109,6 +109,10 @@ static bool isAutoVarArray(const Token *tok)
     if (tok->isUnaryOp("&") && Token::simpleMatch(tok->astOperand1(), "["))
         return isAutoVarArray(tok->astOperand1()->astOperand1());
 
+    // (T *)x
+    if (tok->str() == "(" && tok->isCast())
+        return isAutoVarArray(tok->astOperand1());
+
     // x+y
     if (tok->str() == "+")
         return isAutoVarArray(tok->astOperand1()) || isAutoVarArray(tok->astOperand2());
@@ -130,7 +134,7 @@ static bool isAutoVarArray(const Token *tok)
 
     // ValueFlow
     if (var->isPointer() && !var->isArgument()) {
-        for (std::list<ValueFlow::Value>::const_iterator it = tok->values().begin(); it != tok->values().end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it = tok->values().begin(); it != tok->values().end(); ++it) {
             const ValueFlow::Value &val = *it;
             if (val.isTokValue() && isAutoVarArray(val.tokvalue))
                 return true;
@@ -263,17 +267,18 @@ void CheckAutoVariables::autoVariables()
                         errorAutoVariableAssignment(tok->next(), false);
                 }
                 tok = tok->tokAt(4);
-            } else if (Token::Match(tok, "[;{}] %var% [") && Token::Match(tok->linkAt(2), "] = & %var%") &&
-                       (isPtrArg(tok->next()) || isArrayArg(tok->next())) && isAutoVar(tok->linkAt(2)->tokAt(3))) {
-                const Token* const varTok = tok->linkAt(2)->tokAt(3);
+            } else if (Token::Match(tok, "[;{}] %var% [") && Token::simpleMatch(tok->linkAt(2), "] =") &&
+                       Token::Match(skipCasts(tok->linkAt(2)->tokAt(2)), "& %var%") &&
+                       (isPtrArg(tok->next()) || isArrayArg(tok->next())) && isAutoVar(skipCasts(tok->linkAt(2)->tokAt(2))->next())) {
+                const Token* const varTok = skipCasts(tok->linkAt(2)->tokAt(2))->next();
                 if (checkRvalueExpression(varTok))
                     errorAutoVariableAssignment(tok->next(), false);
             }
             // Critical return
             else if (Token::Match(tok, "return %var% ;") && isAutoVar(tok->next())) {
-                const std::list<ValueFlow::Value> &values = tok->next()->values();
+                const std::vector<ValueFlow::Value> &values = tok->next()->values();
                 const ValueFlow::Value *value = nullptr;
-                for (std::list<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
+                for (std::vector<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
                     if (!it->isTokValue())
                         continue;
                     if (!mSettings->inconclusive && it->isInconclusive())
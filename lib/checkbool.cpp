@@ -296,6 +296,9 @@ void CheckBool::checkAssignBoolToPointer()
                 const Token *lhs = tok->astOperand1();
                 while (lhs && (lhs->str() == "." || lhs->str() == "::"))
                     lhs = lhs->astOperand2();
+                // declaration with initialization: "int *p = ..."
+                if (tok->previous()->variable() && tok->previous()->variable()->nameToken() == tok->previous())
+                    lhs = tok->previous();
                 if (!lhs || !lhs->variable() || !lhs->variable()->isPointer())
                     continue;
 
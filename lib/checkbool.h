@@ -58,13 +58,6 @@ public:
         checkBool.checkComparisonOfBoolWithInt();
         checkBool.checkAssignBoolToFloat();
         checkBool.pointerArithBool();
-    }
-
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckBool checkBool(tokenizer, settings, errorLogger);
-
-        // Checks
         checkBool.checkComparisonOfFuncReturningBool();
         checkBool.checkComparisonOfBoolWithBool();
         checkBool.checkIncrementBoolean();
@@ -33,26 +33,26 @@ static const CWE CWE664(664);
 
 void CheckBoost::checkBoostForeachModification()
 {
-    const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
-    for (const Scope * scope : symbolDatabase->functionScopes) {
-        for (const Token *tok = scope->bodyStart->next(); tok && tok != scope->bodyEnd; tok = tok->next()) {
-            if (!Token::simpleMatch(tok, "BOOST_FOREACH ("))
-                continue;
+    TokenVisitor::walk(mTokenizer, std::vector<TokenVisitor *>(1, this));
+}
+
+void CheckBoost::visitFunctionCall(const Token *tok)
+{
+    if (tok->str() != "BOOST_FOREACH")
+        return;
 
-            const Token *containerTok = tok->next()->link()->previous();
-            if (!Token::Match(containerTok, "%var% ) {"))
-                continue;
+    const Token *containerTok = tok->next()->link()->previous();
+    if (!Token::Match(containerTok, "%var% ) {"))
+        return;
 
-            const Token *tok2 = containerTok->tokAt(2);
-            const Token *end = tok2->link();
-            for (; tok2 != end; tok2 = tok2->next()) {
-                if (Token::Match(tok2, "%varid% . insert|erase|push_back|push_front|pop_front|pop_back|clear|swap|resize|assign|merge|remove|remove_if|reverse|sort|splice|unique|pop|push", containerTok->varId())) {
-                    const Token* nextStatement = Token::findsimplematch(tok2->linkAt(3), ";", end);
-                    if (!Token::Match(nextStatement, "; break|return|throw"))
-                        boostForeachError(tok2);
-                    break;
-                }
-            }
+    const Token *tok2 = containerTok->tokAt(2);
+    const Token *end = tok2->link();
+    for (; tok2 != end; tok2 = tok2->next()) {
+        if (Token::Match(tok2, "%varid% . insert|erase|push_back|push_front|pop_front|pop_back|clear|swap|resize|assign|merge|remove|remove_if|reverse|sort|splice|unique|pop|push", containerTok->varId())) {
+            const Token* nextStatement = Token::findsimplematch(tok2->linkAt(3), ";", end);
+            if (!Token::Match(nextStatement, "; break|return|throw"))
+                boostForeachError(tok2);
+            break;
         }
     }
 }
@@ -27,6 +27,7 @@
 #include "tokenize.h"
 
 #include <string>
+#include <vector>
 
 class ErrorLogger;
 class Settings;
@@ -37,7 +38,7 @@ class Token;
 
 
 /** @brief %Check Boost usage */
-class CPPCHECKLIB CheckBoost : public Check {
+class CPPCHECKLIB CheckBoost : public Check, private TokenVisitor {
 public:
     /** This constructor is used when registering the CheckClass */
     CheckBoost() : Check(myName()) {
@@ -48,8 +49,8 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger) {
     }
 
-    /** Simplified checks. The token list is simplified. */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         if (!tokenizer->isCPP())
             return;
 
@@ -58,10 +59,26 @@ public:
         checkBoost.checkBoostForeachModification();
     }
 
+    TokenVisitor * createTokenVisitor(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) const override {
+        if (!tokenizer->isCPP())
+            return nullptr;
+        return new CheckBoost(tokenizer, settings, errorLogger);
+    }
+
+    std::vector<std::string> triggerNames(const Settings * /*settings*/) const override {
+        return { "BOOST_FOREACH" };
+    }
+
     /** @brief %Check for container modification while using the BOOST_FOREACH macro */
     void checkBoostForeachModification();
 
 private:
+    unsigned int events() const override {
+        return FUNCTION_CALL;
+    }
+
+    void visitFunctionCall(const Token *tok) override;
+
     void boostForeachError(const Token *tok);
 
     void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const override {
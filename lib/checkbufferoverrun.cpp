@@ -376,8 +376,15 @@ static bool checkMinSizes(const std::vector<Library::ArgumentChecks::MinSize> &m
                 const MathLib::bigint sz = MathLib::toLongNumber(argtok->str());
                 if (sz > arraySize)
                     error = true;
-            } else if (argtok->tokType() == Token::eChar && Token::Match(argtok->next(), ",|)") && charSizeToken)
+            } else if (argtok->tokType() == Token::eChar && Token::Match(argtok->next(), ",|)") && charSizeToken) {
                 *charSizeToken = argtok; //sizeArgumentAsCharError(argtok);
+            } else {
+                // the size is an expression with a known value, for instance "sizeof(buf)+1"
+                const std::vector<const Token *> args = getArguments(ftok);
+                const Token *arg = (minsize->arg <= static_cast<int>(args.size())) ? args[minsize->arg - 1] : nullptr;
+                if (arg && arg->hasKnownIntValue() && arg->values().front().intvalue > arraySize)
+                    error = true;
+            }
             break;
         case Library::ArgumentChecks::MinSize::MUL:
             // TODO: handle arbitrary arg2
@@ -788,6 +795,18 @@ void CheckBufferOverrun::checkScope(const Token *tok, const std::vector<const st
                 pointerIsOutOfBounds = true;
         }
 
+        else if (declarationId && Token::Match(tok, "%varid% += %num% ;", declarationId) && Token::Match(tok->previous(), "[;{}]")) {
+            const MathLib::bigint index = MathLib::toLongNumber(tok->strAt(2));
+            if (printPortability && index > size)
+                pointerOutOfBoundsError(tok->next());
+            if (index >= size)
+                pointerIsOutOfBounds = true;
+        }
+
+        else if (pointerIsOutOfBounds && Token::Match(tok, "%varid% %assign%", declarationId)) {
+            pointerIsOutOfBounds = false;
+        }
+
         else if (pointerIsOutOfBounds && Token::Match(tok, "[;{}=] * %varid% [;=]", declarationId)) {
             outOfBoundsError(tok->tokAt(2), tok->strAt(2), false, 0, 0);
         }
@@ -1177,7 +1196,7 @@ void CheckBufferOverrun::checkGlobalAndLocalVariable()
             if (!value)
                 continue;
 
-            for (std::list<ValueFlow::Value>::const_iterator it = tok->values().begin(); it != tok->values().end(); ++it) {
+            for (std::vector<ValueFlow::Value>::const_iterator it = tok->values().begin(); it != tok->values().end(); ++it) {
                 if (!it->isTokValue() || !it->tokvalue)
                     continue;
                 const Variable *var = it->tokvalue->variable();
@@ -1334,7 +1353,7 @@ void CheckBufferOverrun::checkStructVariable()
     for (std::size_t i = 0; i < classes; ++i) {
         const Scope * scope = symbolDatabase->classAndStructScopes[i];
 
-        for (std::list<Variable>::const_iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var) {
+        for (ChunkedList<Variable>::const_iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var) {
             if (!var->isArray())
                 continue;
             // create ArrayInfo from the array variable
@@ -2021,8 +2040,8 @@ Check::FileInfo* CheckBufferOverrun::getFileInfo(const Tokenizer *tokenizer, con
     }
 
     // Arrays..
-    const std::list<Variable> &varlist = symbolDB->scopeList.front().varlist;
-    for (std::list<Variable>::const_iterator it = varlist.begin(); it != varlist.end(); ++it) {
+    const ChunkedList<Variable> &varlist = symbolDB->scopeList.front().varlist;
+    for (ChunkedList<Variable>::const_iterator it = varlist.begin(); it != varlist.end(); ++it) {
         const Variable &var = *it;
         if (!var.isStatic() && var.isArray() && var.dimensions().size() == 1U && var.dimension(0U) > 0U)
             fileInfo->arraySize[var.name()] = var.dimension(0U);
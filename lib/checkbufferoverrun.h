@@ -73,8 +73,11 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger) {
     }
 
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckBufferOverrun checkBufferOverrun(tokenizer, settings, errorLogger);
+        checkBufferOverrun.bufferOverrun();
+        checkBufferOverrun.checkStringArgument();
+
         checkBufferOverrun.checkGlobalAndLocalVariable();
         if (tokenizer && tokenizer->isMaxTime())
             return;
@@ -85,12 +88,6 @@ public:
         checkBufferOverrun.negativeArraySize();
     }
 
-    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckBufferOverrun checkBufferOverrun(tokenizer, settings, errorLogger);
-        checkBufferOverrun.bufferOverrun();
-        checkBufferOverrun.checkStringArgument();
-    }
-
     /** @brief %Check for buffer overruns (single pass, use ast and valueflow) */
     void bufferOverrun();
 
@@ -62,14 +62,6 @@ public:
         // can't be a simplified check .. the 'sizeof' is used.
         checkClass.checkMemset();
         checkClass.checkUnsafeClassDivZero();
-    }
-
-    /** @brief Run checks on the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        if (tokenizer->isC())
-            return;
-
-        CheckClass checkClass(tokenizer, settings, errorLogger);
 
         // Coding style checks
         checkClass.constructors();
@@ -208,6 +200,7 @@ private:
         c.noOperatorEqError(nullptr, false, nullptr, false);
         c.noDestructorError(nullptr, false, nullptr);
         c.uninitVarError(nullptr, false, "classname", "varname", false);
+        c.uninitVarError(nullptr, true, "classname", "varname", false);
         c.operatorEqVarError(nullptr, "classname", emptyString, false);
         c.unusedPrivateFunctionError(nullptr, "classname", "funcname");
         c.memsetError(nullptr, "memfunc", "classname", "class");
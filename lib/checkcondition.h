@@ -60,11 +60,7 @@ public:
         checkCondition.checkInvalidTestForOverflow();
         checkCondition.alwaysTrueFalse();
         checkCondition.checkPointerAdditionResultNotNull();
-    }
 
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckCondition checkCondition(tokenizer, settings, errorLogger);
         checkCondition.assignIf();
         checkCondition.checkBadBitmaskCheck();
         checkCondition.comparison();
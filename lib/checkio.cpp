@@ -53,6 +53,30 @@ static const CWE CWE687(687U);  // Function Call With Incorrectly Specified Argu
 static const CWE CWE704(704U);  // Incorrect Type Conversion or Cast
 static const CWE CWE910(910U);  // Use of Expired File Descriptor
 
+std::vector<std::string> CheckIO::triggerNames(const Settings *settings) const
+{
+    std::vector<std::string> names = {
+        // checkCoutCerrMisusage
+        "cout", "cerr",
+        // checkFileUsage
+        "FILE", "stdin", "stdout", "stderr",
+        "fopen", "freopen", "tmpfile", "_wfopen", "_wfreopen", "fopen_s", "freopen_s", "_wfopen_s", "_wfreopen_s", "fclose",
+        "rewind", "fseek", "_fseeki64", "fsetpos", "fgetpos", "ftell", "fflush",
+        "fgetc", "fgetwc", "fgets", "fgetws", "fread", "fwscanf", "getc", "fscanf_s", "fwscanf_s", "ungetc", "ungetwc",
+        "fputc", "fputwc", "fputs", "fputws", "fwrite", "fprintf", "fwprintf", "putcc", "fprintf_s", "fwprintf_s",
+        "clearerr", "feof", "ferror", "setbuf", "setvbuf",
+        // invalidScanf
+        "scanf", "vscanf", "sscanf", "vsscanf", "fscanf", "vfscanf",
+        // checkWrongPrintfScanfArguments, also the library format string functions below
+        "swprintf", "sprintf_s", "swprintf_s", "_snprintf_s", "_snwprintf_s"
+    };
+    for (std::map<std::string, Library::Function>::const_iterator it = settings->library.functions.begin(); it != settings->library.functions.end(); ++it) {
+        if (it->second.formatstr)
+            names.push_back(it->first);
+    }
+    return names;
+}
+
 //---------------------------------------------------------------------------
 //    std::cout << std::cout;
 //---------------------------------------------------------------------------
@@ -115,6 +139,18 @@ namespace {
     const std::set<std::string> whitelist = { "clearerr", "feof", "ferror", "fgetpos", "ftell", "setbuf", "setvbuf", "ungetc", "ungetwc" };
 }
 
+// Is the function call in a while condition that is evaluated again after the loop body?
+static bool isInRepeatedWhileCondition(const Token *ftok)
+{
+    for (const Token *parent = ftok->next()->astParent(); parent; parent = parent->astParent()) {
+        if (!Token::simpleMatch(parent->previous(), "while (") || !Token::simpleMatch(parent->link(), ") {"))
+            continue;
+        const Token *bodyStart = parent->link()->next();
+        return !Token::findmatch(bodyStart, "break|return|goto|throw", bodyStart->link());
+    }
+    return false;
+}
+
 void CheckIO::checkFileUsage()
 {
     const bool windows = mSettings->isWindowsPlatform();
@@ -303,7 +339,7 @@ void CheckIO::checkFileUsage()
                         ioWithoutPositioningError(tok);
                     break;
                 case Filepointer::CLOSE:
-                    if (f.mode == CLOSED)
+                    if (f.mode == CLOSED || (f.mode != UNKNOWN_OM && isInRepeatedWhileCondition(tok)))
                         useClosedFileError(tok);
                     else
                         f.mode = CLOSED;
@@ -27,6 +27,7 @@
 
 #include <ostream>
 #include <string>
+#include <vector>
 
 class Function;
 class Settings;
@@ -54,17 +55,14 @@ public:
         CheckIO checkIO(tokenizer, settings, errorLogger);
 
         checkIO.checkWrongPrintfScanfArguments();
-    }
-
-    /** @brief Run checks on the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckIO checkIO(tokenizer, settings, errorLogger);
 
         checkIO.checkCoutCerrMisusage();
         checkIO.checkFileUsage();
         checkIO.invalidScanf();
     }
 
+    std::vector<std::string> triggerNames(const Settings *settings) const override;
+
     /** @brief %Check for missusage of std::cout */
     void checkCoutCerrMisusage();
 
@@ -162,6 +160,7 @@ private:
         c.invalidPrintfArgTypeError_float(nullptr,  1, "f", nullptr);
         c.invalidLengthModifierError(nullptr,  1, "I");
         c.invalidScanfFormatWidthError(nullptr,  10, 5, nullptr, 's');
+        c.reportError(nullptr, Severity::warning, "invalidScanfFormatWidth_smaller", "Width 5 given in format string (no. 10) is smaller than destination buffer 'varname[10]'.", CWE(0U), true);
         c.wrongPrintfScanfPosixParameterPositionError(nullptr,  "printf", 2, 1);
     }
 
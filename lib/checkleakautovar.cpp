@@ -97,7 +97,7 @@ void VarInfo::possibleUsageAll(const std::string &functionName)
 {
     possibleUsage.clear();
     for (std::map<unsigned int, AllocInfo>::const_iterator it = alloctype.begin(); it != alloctype.end(); ++it)
-        possibleUsage[it->first] = functionName;
+        possibleUsage.edit()[it->first] = functionName;
 }
 
 
@@ -167,13 +167,14 @@ void CheckLeakAutoVar::check()
         varInfo.conditionalAlloc.clear();
 
         // Clear reference arguments from varInfo..
-        std::map<unsigned int, VarInfo::AllocInfo>::iterator it = varInfo.alloctype.begin();
-        while (it != varInfo.alloctype.end()) {
+        std::map<unsigned int, VarInfo::AllocInfo> &alloctype = varInfo.alloctype.edit();
+        std::map<unsigned int, VarInfo::AllocInfo>::iterator it = alloctype.begin();
+        while (it != alloctype.end()) {
             const Variable *var = symbolDatabase->getVariableFromVarId(it->first);
             if (!var ||
                 (var->isArgument() && var->isReference()) ||
                 (!var->isArgument() && !var->isLocal()))
-                varInfo.alloctype.erase(it++);
+                alloctype.erase(it++);
             else
                 ++it;
         }
@@ -234,9 +235,9 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
                                   VarInfo *varInfo,
                                   std::set<unsigned int> notzero)
 {
-    std::map<unsigned int, VarInfo::AllocInfo> &alloctype = varInfo->alloctype;
-    std::map<unsigned int, std::string> &possibleUsage = varInfo->possibleUsage;
-    const std::set<unsigned int> conditionalAlloc(varInfo->conditionalAlloc);
+    CopyOnWrite<std::map<unsigned int, VarInfo::AllocInfo> > &alloctype = varInfo->alloctype;
+    CopyOnWrite<std::map<unsigned int, std::string> > &possibleUsage = varInfo->possibleUsage;
+    const CopyOnWrite<std::set<unsigned int> > conditionalAlloc(varInfo->conditionalAlloc);
 
     // Parse all tokens
     const Token * const endToken = startToken->link();
@@ -308,7 +309,11 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
             // Variable has already been allocated => error
             if (conditionalAlloc.find(varTok->varId()) == conditionalAlloc.end())
                 leakIfAllocated(varTok, *varInfo);
+            // references of the variable are still bound after the assignment
+            const bool referenced = varInfo->referenced.find(varTok->varId()) != varInfo->referenced.end();
             varInfo->erase(varTok->varId());
+            if (referenced)
+                varInfo->referenced.insert(varTok->varId());
 
             // not a local variable nor argument?
             const Variable *var = varTok->variable();
@@ -334,14 +339,14 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
             if (tokRightAstOperand && Token::Match(tokRightAstOperand->previous(), "%type% (")) {
                 const Library::AllocFunc* f = mSettings->library.alloc(tokRightAstOperand->previous());
                 if (f && f->arg == -1) {
-                    VarInfo::AllocInfo& varAlloc = alloctype[varTok->varId()];
+                    VarInfo::AllocInfo& varAlloc = alloctype.edit()[varTok->varId()];
                     varAlloc.type = f->groupId;
                     varAlloc.status = VarInfo::ALLOC;
                 }
             } else if (mTokenizer->isCPP() && Token::Match(varTok->tokAt(2), "new !!(")) {
                 const Token* tok2 = varTok->tokAt(2)->astOperand1();
                 const bool arrayNew = (tok2 && (tok2->str() == "[" || (tok2->str() == "(" && tok2->astOperand1() && tok2->astOperand1()->str() == "[")));
-                VarInfo::AllocInfo& varAlloc = alloctype[varTok->varId()];
+                VarInfo::AllocInfo& varAlloc = alloctype.edit()[varTok->varId()];
                 varAlloc.type = arrayNew ? NEW_ARRAY : NEW;
                 varAlloc.status = VarInfo::ALLOC;
             }
@@ -369,14 +374,14 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
                     if (Token::Match(innerTok->tokAt(2), "%type% (")) {
                         const Library::AllocFunc* f = mSettings->library.alloc(innerTok->tokAt(2));
                         if (f && f->arg == -1) {
-                            VarInfo::AllocInfo& varAlloc = alloctype[innerTok->varId()];
+                            VarInfo::AllocInfo& varAlloc = alloctype.edit()[innerTok->varId()];
                             varAlloc.type = f->groupId;
                             varAlloc.status = VarInfo::ALLOC;
                         }
                     } else if (mTokenizer->isCPP() && Token::Match(innerTok->tokAt(2), "new !!(")) {
                         const Token* tok2 = innerTok->tokAt(2)->astOperand1();
                         const bool arrayNew = (tok2 && (tok2->str() == "[" || (tok2->str() == "(" && tok2->astOperand1() && tok2->astOperand1()->str() == "[")));
-                        VarInfo::AllocInfo& varAlloc = alloctype[innerTok->varId()];
+                        VarInfo::AllocInfo& varAlloc = alloctype.edit()[innerTok->varId()];
                         varAlloc.type = arrayNew ? NEW_ARRAY : NEW;
                         varAlloc.status = VarInfo::ALLOC;
                     }
@@ -472,8 +477,8 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
                     }
                 }
 
-                // Conditional allocation in varInfo1
-                for (it = varInfo1.alloctype.begin(); it != varInfo1.alloctype.end(); ++it) {
+                // Conditional allocation in varInfo1. Nothing to do if the if code didn't change anything
+                for (it = varInfo1.alloctype.begin(); !varInfo1.alloctype.shares(old.alloctype) && it != varInfo1.alloctype.end(); ++it) {
                     if (varInfo2.alloctype.find(it->first) == varInfo2.alloctype.end() &&
                         old.alloctype.find(it->first) == old.alloctype.end()) {
                         varInfo->conditionalAlloc.insert(it->first);
@@ -481,7 +486,7 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
                 }
 
                 // Conditional allocation in varInfo2
-                for (it = varInfo2.alloctype.begin(); it != varInfo2.alloctype.end(); ++it) {
+                for (it = varInfo2.alloctype.begin(); !varInfo2.alloctype.shares(old.alloctype) && it != varInfo2.alloctype.end(); ++it) {
                     if (varInfo1.alloctype.find(it->first) == varInfo1.alloctype.end() &&
                         old.alloctype.find(it->first) == old.alloctype.end()) {
                         varInfo->conditionalAlloc.insert(it->first);
@@ -502,11 +507,14 @@ void CheckLeakAutoVar::checkScope(const Token * const startToken,
                     }
                 }
 
-                alloctype.insert(varInfo1.alloctype.begin(), varInfo1.alloctype.end());
-                alloctype.insert(varInfo2.alloctype.begin(), varInfo2.alloctype.end());
+                // share the data of the if code and add what is different in the else code
+                alloctype = varInfo1.alloctype;
+                if (!varInfo2.alloctype.shares(varInfo1.alloctype))
+                    alloctype.insert(varInfo2.alloctype.begin(), varInfo2.alloctype.end());
 
-                possibleUsage.insert(varInfo1.possibleUsage.begin(), varInfo1.possibleUsage.end());
-                possibleUsage.insert(varInfo2.possibleUsage.begin(), varInfo2.possibleUsage.end());
+                possibleUsage = varInfo1.possibleUsage;
+                if (!varInfo2.possibleUsage.shares(varInfo1.possibleUsage))
+                    possibleUsage.insert(varInfo2.possibleUsage.begin(), varInfo2.possibleUsage.end());
             }
         }
 
@@ -677,6 +685,9 @@ const Token * CheckLeakAutoVar::checkTokenInsideExpression(const Token * const t
                 varInfo->erase(tok->varId());
             } else if (tok->strAt(-1) == "=") {
                 varInfo->erase(tok->varId());
+            } else if (var->second.status == VarInfo::DEALLOC && Token::Match(tok->previous(), ", %var% =")) {
+                // "free(p), p = 0;"
+                varInfo->erase(tok->varId());
             }
         } else if (Token::Match(tok->previous(), "& %name% = %var% ;")) {
             varInfo->referenced.insert(tok->tokAt(2)->varId());
@@ -700,12 +711,12 @@ const Token * CheckLeakAutoVar::checkTokenInsideExpression(const Token * const t
 
 void CheckLeakAutoVar::changeAllocStatus(VarInfo *varInfo, const VarInfo::AllocInfo& allocation, const Token* tok, const Token* arg)
 {
-    std::map<unsigned int, VarInfo::AllocInfo> &alloctype = varInfo->alloctype;
-    const std::map<unsigned int, VarInfo::AllocInfo>::iterator var = alloctype.find(arg->varId());
+    CopyOnWrite<std::map<unsigned int, VarInfo::AllocInfo> > &alloctype = varInfo->alloctype;
+    const std::map<unsigned int, VarInfo::AllocInfo>::const_iterator var = alloctype.find(arg->varId());
     if (var != alloctype.end()) {
         if (allocation.status == VarInfo::NOALLOC) {
             // possible usage
-            varInfo->possibleUsage[arg->varId()] = tok->str();
+            varInfo->possibleUsage.edit()[arg->varId()] = tok->str();
             if (var->second.status == VarInfo::DEALLOC && arg->previous()->str() == "&")
                 varInfo->erase(arg->varId());
         } else if (var->second.managed()) {
@@ -716,11 +727,12 @@ void CheckLeakAutoVar::changeAllocStatus(VarInfo *varInfo, const VarInfo::AllocI
             varInfo->erase(arg->varId());
         } else {
             // deallocation
-            var->second.status = allocation.status;
-            var->second.type = allocation.type;
+            VarInfo::AllocInfo &varAlloc = alloctype.edit()[arg->varId()];
+            varAlloc.status = allocation.status;
+            varAlloc.type = allocation.type;
         }
     } else if (allocation.status != VarInfo::NOALLOC) {
-        alloctype[arg->varId()].status = VarInfo::DEALLOC;
+        alloctype.edit()[arg->varId()].status = VarInfo::DEALLOC;
     }
 }
 
@@ -813,8 +825,8 @@ void CheckLeakAutoVar::functionCall(const Token *tokName, const Token *tokOpenin
 void CheckLeakAutoVar::leakIfAllocated(const Token *vartok,
                                        const VarInfo &varInfo)
 {
-    const std::map<unsigned int, VarInfo::AllocInfo> &alloctype = varInfo.alloctype;
-    const std::map<unsigned int, std::string> &possibleUsage = varInfo.possibleUsage;
+    const CopyOnWrite<std::map<unsigned int, VarInfo::AllocInfo> > &alloctype = varInfo.alloctype;
+    const CopyOnWrite<std::map<unsigned int, std::string> > &possibleUsage = varInfo.possibleUsage;
 
     const std::map<unsigned int, VarInfo::AllocInfo>::const_iterator var = alloctype.find(vartok->varId());
     if (var != alloctype.end() && var->second.status == VarInfo::ALLOC) {
@@ -829,8 +841,8 @@ void CheckLeakAutoVar::leakIfAllocated(const Token *vartok,
 
 void CheckLeakAutoVar::ret(const Token *tok, const VarInfo &varInfo)
 {
-    const std::map<unsigned int, VarInfo::AllocInfo> &alloctype = varInfo.alloctype;
-    const std::map<unsigned int, std::string> &possibleUsage = varInfo.possibleUsage;
+    const CopyOnWrite<std::map<unsigned int, VarInfo::AllocInfo> > &alloctype = varInfo.alloctype;
+    const CopyOnWrite<std::map<unsigned int, std::string> > &possibleUsage = varInfo.possibleUsage;
 
     const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
     for (std::map<unsigned int, VarInfo::AllocInfo>::const_iterator it = alloctype.begin(); it != alloctype.end(); ++it) {
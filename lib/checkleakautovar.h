@@ -27,6 +27,7 @@
 #include "library.h"
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -36,6 +37,76 @@ class Token;
 class Tokenizer;
 
 
+/**
+ * @brief std::map / std::set that shares its data with copies until
+ * one of them is modified. Reading is done through the const interface,
+ * modifications must go through edit() or the modifying helpers.
+ */
+template<class Container>
+class CopyOnWrite {
+public:
+    typedef typename Container::key_type key_type;
+    typedef typename Container::value_type value_type;
+    typedef typename Container::const_iterator const_iterator;
+
+    const_iterator begin() const {
+        return data().begin();
+    }
+    const_iterator end() const {
+        return data().end();
+    }
+    const_iterator find(const key_type &key) const {
+        return data().find(key);
+    }
+    bool empty() const {
+        return data().empty();
+    }
+    std::size_t size() const {
+        return data().size();
+    }
+
+    /** Is the data shared with other? Then the containers are equal. */
+    bool shares(const CopyOnWrite &other) const {
+        return mData == other.mData;
+    }
+
+    /** Get container that can be modified. The data is copied if it is shared. */
+    Container &edit() {
+        if (!mData)
+            mData = std::make_shared<Container>();
+        else if (mData.use_count() > 1)
+            mData = std::make_shared<Container>(*mData);
+        return *mData;
+    }
+
+    void insert(const value_type &value) {
+        edit().insert(value);
+    }
+    void insert(const_iterator first, const_iterator last) {
+        if (first != last)
+            edit().insert(first, last);
+    }
+    void erase(const key_type &key) {
+        if (data().find(key) != data().end())
+            edit().erase(key);
+    }
+    void clear() {
+        mData.reset();
+    }
+    void swap(CopyOnWrite &other) {
+        mData.swap(other.mData);
+    }
+
+private:
+    const Container &data() const {
+        static const Container emptyContainer;
+        return mData ? *mData : emptyContainer;
+    }
+
+    /** null when empty */
+    std::shared_ptr<Container> mData;
+};
+
 class CPPCHECKLIB VarInfo {
 public:
     enum AllocStatus { OWNED = -2, DEALLOC = -1, NOALLOC = 0, ALLOC = 1 };
@@ -52,10 +123,12 @@ public:
             return status < 0;
         }
     };
-    std::map<unsigned int, AllocInfo> alloctype;
-    std::map<unsigned int, std::string> possibleUsage;
-    std::set<unsigned int> conditionalAlloc;
-    std::set<unsigned int> referenced;
+
+    /** The info is copied at each branch, so the containers are shared until they are modified */
+    CopyOnWrite<std::map<unsigned int, AllocInfo> > alloctype;
+    CopyOnWrite<std::map<unsigned int, std::string> > possibleUsage;
+    CopyOnWrite<std::set<unsigned int> > conditionalAlloc;
+    CopyOnWrite<std::set<unsigned int> > referenced;
 
     void clear() {
         alloctype.clear();
@@ -103,8 +176,8 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger) {
     }
 
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckLeakAutoVar checkLeakAutoVar(tokenizer, settings, errorLogger);
         checkLeakAutoVar.check();
     }
@@ -152,6 +225,10 @@ private:
         c.deallocReturnError(nullptr, "p");
         c.configurationInfo(nullptr, "f");  // user configuration is needed to complete analysis
         c.doubleFreeError(nullptr, "varname", 0);
+        c.leakError(nullptr, "varname", 0);
+        c.leakError(nullptr, "varname", 1);
+        c.mismatchError(nullptr, "varname");
+        c.deallocUseError(nullptr, "varname");
     }
 
     static std::string myName() {
@@ -35,6 +35,7 @@
 #include <cstddef>
 #include <set>
 #include <stack>
+#include <vector>
 
 //---------------------------------------------------------------------------
 
@@ -114,6 +115,38 @@ bool CheckMemoryLeak::isclass(const Token *tok, unsigned int varid) const
 }
 //---------------------------------------------------------------------------
 
+/** is the pointer known to be null in "realloc(p, n)", i.e. it works like "malloc(n)" */
+static bool isNullPointer(const Token *tok, const Settings *settings, bool cpp)
+{
+    if (tok->hasKnownIntValue())
+        return tok->values().front().intvalue == 0;
+    // "p = 0; if ((p = realloc(p, n)) == NULL)"
+    const Variable *var = tok->variable();
+    if (!var || !var->isLocal() || var->isStatic())
+        return false;
+    const Token *init = var->nameToken();
+    if (Token::Match(init, "%varid% ; %varid% =", tok->varId()))
+        init = init->tokAt(2);
+    if (!Token::Match(init, "%varid% = 0|NULL|nullptr ;", tok->varId()))
+        return false;
+    // a loop may reallocate the pointer in a previous iteration
+    for (const Scope *scope = tok->scope(); scope && scope != var->scope(); scope = scope->nestedIn) {
+        if (scope->type == Scope::eFor || scope->type == Scope::eWhile || scope->type == Scope::eDo)
+            return false;
+    }
+    // the pointer may be assigned by the same expression: "p = realloc(p, n)"
+    const Token *assignTok = tok->astParent();
+    while (assignTok && assignTok->str() != "=")
+        assignTok = assignTok->astParent();
+    const Token *end = tok;
+    if (assignTok) {
+        end = assignTok;
+        while (end->astOperand1())
+            end = end->astOperand1();
+    }
+    return !isVariableChanged(init->tokAt(3), end, tok->varId(), false, settings, cpp);
+}
+
 CheckMemoryLeak::AllocType CheckMemoryLeak::getAllocationType(const Token *tok2, unsigned int varid, std::list<const Function*> *callstack) const
 {
     // What we may have...
@@ -121,10 +154,12 @@ CheckMemoryLeak::AllocType CheckMemoryLeak::getAllocationType(const Token *tok2,
     //     * var = new char[10];
     //     * var = strdup("hello");
     //     * var = strndup("hello", 3);
+    //     * var = static_cast<char *>(malloc(10));
     if (tok2 && tok2->str() == "(") {
         tok2 = tok2->link();
         tok2 = tok2 ? tok2->next() : nullptr;
     }
+    tok2 = skipCasts(tok2);
     if (! tok2)
         return No;
     if (tok2->str() == "::")
@@ -134,7 +169,8 @@ CheckMemoryLeak::AllocType CheckMemoryLeak::getAllocationType(const Token *tok2,
 
     if (!Token::Match(tok2, "%name% ::|. %type%")) {
         // Using realloc..
-        if (varid && Token::Match(tok2, "realloc ( %any% ,") && tok2->tokAt(2)->varId() != varid)
+        if (varid && Token::Match(tok2, "realloc ( %any% ,") &&
+            (tok2->tokAt(2)->varId() != varid || isNullPointer(tok2->tokAt(2), mSettings_, mTokenizer_->isCPP())))
             return Malloc;
 
         if (mTokenizer_->isCPP() && tok2->str() == "new") {
@@ -239,7 +275,9 @@ CheckMemoryLeak::AllocType CheckMemoryLeak::getDeallocationType(const Token *tok
 
         int argNr = 1;
         for (const Token* tok2 = tok->tokAt(2); tok2; tok2 = tok2->nextArgument()) {
-            const Token* vartok = tok2;
+            const Token* vartok = skipCasts(tok2);
+            if (Token::Match(vartok, "( %varid% )", varid))
+                vartok = vartok->next();
             while (Token::Match(vartok, "%name% .|::"))
                 vartok = vartok->tokAt(2);
 
@@ -271,6 +309,16 @@ CheckMemoryLeak::AllocType CheckMemoryLeak::getDeallocationType(const Token *tok
     return No;
 }
 
+std::vector<std::string> CheckMemoryLeak::allocationNames(const Settings *settings)
+{
+    std::vector<std::string> names = settings->library.allocDeallocNames();
+    names.insert(names.end(), {
+        "new", "delete", "realloc", "g_try_realloc", "fcloseall", "__cppcheck_lock", "__cppcheck_unlock",
+        "open", "openat", "creat", "mkstemp", "mkostemp", "socket", "popen", "close", "pclose"
+    });
+    return names;
+}
+
 //--------------------------------------------------------------------------
 
 
@@ -385,6 +433,10 @@ CheckMemoryLeak::AllocType CheckMemoryLeak::functionReturnType(const Function* f
     for (const Token* tok = func->functionScope->bodyStart; tok != func->functionScope->bodyEnd; tok = tok->next()) {
         if (Token::Match(tok, "%varid% =", varid)) {
             allocType = getAllocationType(tok->tokAt(2), varid, callstack);
+            // "p = realloc(p, n)" where p is null does not use p
+            const Token *ftok = skipCasts(tok->tokAt(2));
+            if (allocType != No && Token::Match(ftok, "realloc ("))
+                tok = ftok->next()->link();
         }
         if (Token::Match(tok, "= %varid% ;", varid)) {
             return No;
@@ -416,7 +468,7 @@ const char *CheckMemoryLeak::functionArgAlloc(const Function *func, unsigned int
     if (!Token::simpleMatch(func->retDef, "void"))
         return "";
 
-    std::list<Variable>::const_iterator arg = func->argumentList.begin();
+    ChunkedList<Variable>::const_iterator arg = func->argumentList.begin();
     for (; arg != func->argumentList.end(); ++arg) {
         if (arg->index() == targetpar-1)
             break;
@@ -472,6 +524,19 @@ static bool notvar(const Token *tok, unsigned int varid)
     return vartok && (vartok->varId() == varid);
 }
 
+/** Is the condition "(var = ..) == 0" or "!(var = ..)"? */
+static bool notvarAssign(const Token *tok, unsigned int varid)
+{
+    if (!tok)
+        return false;
+    const Token *assignTok = nullptr;
+    if (tok->str() == "!")
+        assignTok = tok->astOperand1();
+    else if (tok->str() == "==" && Token::Match(tok->astOperand2(), "0|NULL|nullptr"))
+        assignTok = tok->astOperand1();
+    return Token::simpleMatch(assignTok, "=") && assignTok->astOperand1() && assignTok->astOperand1()->varId() == varid;
+}
+
 static bool ifvar(const Token *tok, unsigned int varid, const std::string &comp, const std::string &rhs)
 {
     if (!Token::simpleMatch(tok, "if ("))
@@ -501,6 +566,21 @@ static bool alwaysTrue(const Token *tok)
     return false;
 }
 
+static bool alwaysFalse(const Token *tok)
+{
+    if (!tok)
+        return false;
+    if (tok->values().size() == 1U &&
+        tok->values().front().isKnown() &&
+        tok->values().front().intvalue == 0)
+        return true;
+    if (tok->str() == "&&")
+        return alwaysFalse(tok->astOperand1()) || alwaysFalse(tok->astOperand2());
+    if (tok->str() == "false")
+        return true;
+    return false;
+}
+
 bool CheckMemoryLeakInFunction::test_white_list(const std::string &funcname, const Settings *settings, bool cpp)
 {
     return ((call_func_white_list.find(funcname)!=call_func_white_list.end()) || settings->library.isLeakIgnore(funcname) || (cpp && funcname == "delete"));
@@ -820,7 +900,7 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                     if (alloc != CheckMemoryLeak::No) {
                         addtoken(&rettail, tok, "realloc");
                         addtoken(&rettail, tok, ";");
-                        tok = tok->tokAt(2);
+                        tok = skipCasts(tok->tokAt(2));
                         if (Token::Match(tok, "%name% ("))
                             tok = tok->next()->link();
                         continue;
@@ -874,8 +954,9 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
 
                     alloctype = alloc;
 
-                    if (Token::Match(tok, "%name% = %type% (")) {
-                        tok = tok->linkAt(3);
+                    const Token *allocTok = Token::Match(tok, "%name% =") ? skipCasts(tok->tokAt(2)) : nullptr;
+                    if (Token::Match(allocTok, "%type% (")) {
+                        tok = allocTok->linkAt(1);
                         continue;
                     }
                 }
@@ -895,7 +976,7 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                         }
 
                         if (!used && !rhs) {
-                            if (Token::Match(tok2, "[=+(,] %varid%", varid)) {
+                            if (Token::Match(tok2, "[=+(,]") && Token::Match(skipCasts(tok2->next()), "%varid%", varid)) {
                                 if (Token::Match(tok2, "[(,]")) {
                                     used = true;
                                     addtoken(&rettail, tok, "use");
@@ -944,13 +1025,23 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                     }
                     dealloctype = dealloc;
 
-                    if (tok->strAt(2) == "(")
-                        tok = tok->linkAt(2);
+                    if (Token::Match(tok, "%name% ("))
+                        tok = tok->linkAt(1);
                     continue;
                 }
             }
 
             // if else switch
+            if (Token::simpleMatch(tok, "if (") &&
+                alwaysFalse(tok->next()->astOperand2()) &&
+                Token::simpleMatch(tok->linkAt(1), ") {")) {
+                // dead code => skip it, the else-block is a plain block
+                tok = tok->linkAt(1)->linkAt(1);
+                if (Token::simpleMatch(tok, "} else {"))
+                    tok = tok->next();
+                continue;
+            }
+
             if (Token::simpleMatch(tok, "if (")) {
                 if (alloctype == Fd) {
                     if (ifvar(tok, varid, ">",  "-1") ||
@@ -1057,6 +1148,13 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
             continue;
         }
 
+        // "do { .. } while (0);" is a plain block
+        else if (Token::simpleMatch(tok, "while ( 0 ) ;") && Token::simpleMatch(tok->previous(), "}") &&
+                 Token::simpleMatch(tok->linkAt(-1)->previous(), "do {")) {
+            tok = tok->linkAt(1);
+            continue;
+        }
+
         // Loops..
         else if ((tok->str() == "for") || (tok->str() == "while")) {
             const Token* const end = tok->linkAt(1);
@@ -1099,6 +1197,9 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                 addtoken(&rettail, tok, "while(!var)");
                 tok = end;
                 continue;
+            } else if (varid && Token::simpleMatch(tok, "while (") && notvarAssign(tok->next()->astOperand2(), varid)) {
+                // "while ((p = alloc()) == NULL) {..}" is only repeated while the allocation fails
+                continue;
             }
 
             addtoken(&rettail, tok, "loop");
@@ -1109,7 +1210,8 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
             continue;
         }
         if ((tok->str() == "do")) {
-            addtoken(&rettail, tok, "do");
+            if (!Token::simpleMatch(tok->linkAt(1), "} while ( 0 ) ;"))
+                addtoken(&rettail, tok, "do");
             continue;
         }
 
@@ -1159,8 +1261,9 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                         break;
                     }
 
+                    // "return (p);" is not a function call
                     if (tok2->str() == "(")
-                        functions.push(tok2->previous());
+                        functions.push(tok2->previous()->str() == "return" ? nullptr : tok2->previous());
                     else if (!functions.empty() && tok2->str() == ")")
                         functions.pop();
 
@@ -1170,6 +1273,7 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                             tok2->strAt(1) == "[") {
                             ;
                         } else if (functions.empty() ||
+                                   !functions.top() ||
                                    !test_white_list(functions.top()->str(), mSettings, mTokenizer->isCPP()) ||
                                    getDeallocationType(functions.top(),varid) != AllocType::No) {
                             use = true;
@@ -1214,7 +1318,7 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
                     rethead->deleteNext();
                 return rethead;
             }
-            if (Token::Match(tok, "[)=] %varid% [+;)]", varid) ||
+            if (Token::Match(tok, ")|%assign% %varid% [+;)]", varid) ||
                 (Token::Match(tok, "%name% + %varid%", varid) &&
                  tok->strAt(3) != "[" &&
                  tok->strAt(3) != ".") ||
@@ -1321,7 +1425,7 @@ Token *CheckMemoryLeakInFunction::getcode(const Token *tok, std::list<const Toke
         }
 
         // Linux lists..
-        if (varid > 0 && Token::Match(tok, "[=(,] & (| %varid% [.[,)]", varid)) {
+        if (varid > 0 && Token::Match(tok, "[=(,] & (| %varid% [.[,);]", varid)) {
             // Is variable passed to a "leak-ignore" function?
             bool leakignore = false;
             if (Token::Match(tok, "[(,]")) {
@@ -2141,16 +2245,17 @@ void CheckMemoryLeakInFunction::checkReallocUsage()
 
         // Search for the "var = realloc(var, 100" pattern within this function
         for (const Token *tok = scope->bodyStart->next(); tok != scope->bodyEnd; tok = tok->next()) {
+            const Token *reallocTok = Token::Match(tok, "%name% =") ? skipCasts(tok->tokAt(2)) : nullptr;
             if (tok->varId() > 0 &&
-                Token::Match(tok, "%name% = realloc|g_try_realloc ( %name% ,") &&
-                tok->varId() == tok->tokAt(4)->varId() &&
+                Token::Match(reallocTok, "realloc|g_try_realloc ( %varid% ,", tok->varId()) &&
+                !isNullPointer(reallocTok->tokAt(2), mSettings, mTokenizer->isCPP()) &&
                 isNoArgument(symbolDatabase, tok->varId())) {
                 // Check that another copy of the pointer wasn't saved earlier in the function
                 if (Token::findmatch(scope->bodyStart, "%name% = %varid% ;", tok, tok->varId()) ||
                     Token::findmatch(scope->bodyStart, "[{};] %varid% = %name% [;=]", tok, tok->varId()))
                     continue;
 
-                const Token* tokEndRealloc = tok->linkAt(3);
+                const Token* tokEndRealloc = reallocTok->linkAt(1);
                 // Check that the allocation isn't followed immediately by an 'if (!var) { error(); }' that might handle failure
                 if (Token::simpleMatch(tokEndRealloc->next(), "; if (") &&
                     notvar(tokEndRealloc->tokAt(3)->astOperand2(), tok->varId())) {
@@ -2201,10 +2306,30 @@ void CheckMemoryLeakInFunction::check()
 {
     const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
 
-    // Check locking/unlocking of global resources..
+    // Prefilter, this is not a summary of the functions: getcode() still runs for each
+    // checked variable. A local variable can only get allocated memory if it is assigned
+    // the result of a function call / new or its address is taken, the other local
+    // variables are skipped. The lock pass only runs if __cppcheck_lock/unlock is used.
+    std::vector<bool> allocationEvent(symbolDatabase->variableList().size(), false);
+    bool lockEvent = false;
     for (const Scope * scope : symbolDatabase->functionScopes) {
-        if (!scope->hasInlineOrLambdaFunction())
-            checkScope(scope->bodyStart->next(), emptyString, 0, scope->functionOf != nullptr, 1);
+        for (const Token *tok = scope->bodyStart->next(); tok != scope->bodyEnd; tok = tok->next()) {
+            if (Token::Match(tok, "__cppcheck_lock|__cppcheck_unlock ("))
+                lockEvent = true;
+            if (!tok->varId() || tok->varId() >= allocationEvent.size())
+                continue;
+            const Token *rhs = (tok->strAt(1) == "=") ? skipCasts(tok->tokAt(2)) : nullptr;
+            if (tok->strAt(-1) == "&" || Token::simpleMatch(rhs, "new") || Token::Match(rhs, "%name% (|::|."))
+                allocationEvent[tok->varId()] = true;
+        }
+    }
+
+    // Check locking/unlocking of global resources..
+    if (lockEvent) {
+        for (const Scope * scope : symbolDatabase->functionScopes) {
+            if (!scope->hasInlineOrLambdaFunction())
+                checkScope(scope->bodyStart->next(), emptyString, 0, scope->functionOf != nullptr, 1);
+        }
     }
 
     // Check variables..
@@ -2212,6 +2337,9 @@ void CheckMemoryLeakInFunction::check()
         if (!var || (!var->isLocal() && !var->isArgument()) || var->isStatic() || !var->scope())
             continue;
 
+        if (var->isLocal() && !allocationEvent[var->declarationId()])
+            continue;
+
         if (var->isReference())
             continue;
 
@@ -2480,12 +2608,16 @@ void CheckMemoryLeakStructMember::checkStructVariable(const Variable * const var
             break;
 
         // Struct member is allocated => check if it is also properly deallocated..
-        else if (Token::Match(tok2->previous(), "[;{}] %varid% . %var% =", variable->declarationId())) {
-            if (getAllocationType(tok2->tokAt(4), tok2->tokAt(2)->varId()) == AllocType::No)
+        else if (Token::Match(tok2->previous(), "[;{}] %varid% . %var% =", variable->declarationId()) ||
+                 Token::Match(tok2->previous(), "[;{}] ( %varid% . %var% ) =", variable->declarationId())) {
+            // "s.p = malloc(10);" or "(s.p) = malloc(10);"
+            const Token *membertok = tok2->str() == "(" ? tok2->tokAt(3) : tok2->tokAt(2);
+            const Token *assigntok = membertok->next()->str() == ")" ? membertok->tokAt(2) : membertok->next();
+            if (getAllocationType(assigntok->next(), membertok->varId()) == AllocType::No)
                 continue;
 
             const unsigned int structid(variable->declarationId());
-            const unsigned int structmemberid(tok2->tokAt(2)->varId());
+            const unsigned int structmemberid(membertok->varId());
 
             // This struct member is allocated.. check that it is deallocated
             unsigned int indentlevel3 = indentlevel2;
@@ -2495,7 +2627,7 @@ void CheckMemoryLeakStructMember::checkStructVariable(const Variable * const var
 
                 else if (tok3->str() == "}") {
                     if (indentlevel3 == 0) {
-                        memoryLeak(tok3, variable->name() + "." + tok2->strAt(2), Malloc);
+                        memoryLeak(tok3, variable->name() + "." + membertok->str(), Malloc);
                         break;
                     }
                     --indentlevel3;
@@ -2526,7 +2658,7 @@ void CheckMemoryLeakStructMember::checkStructVariable(const Variable * const var
                 // Deallocating the struct..
                 else if (Token::Match(tok3, "free|kfree ( %varid% )", structid)) {
                     if (indentlevel2 == 0)
-                        memoryLeak(tok3, variable->name() + "." + tok2->strAt(2), Malloc);
+                        memoryLeak(tok3, variable->name() + "." + membertok->str(), Malloc);
                     break;
                 }
 
@@ -2574,7 +2706,7 @@ void CheckMemoryLeakStructMember::checkStructVariable(const Variable * const var
                     if (!Token::Match(tok3, "return %varid% ;", structid) &&
                         !Token::Match(tok3, "return & %varid%", structid) &&
                         !(Token::Match(tok3, "return %varid% . %var%", structid) && tok3->tokAt(3)->varId() == structmemberid)) {
-                        memoryLeak(tok3, variable->name() + "." + tok2->strAt(2), Malloc);
+                        memoryLeak(tok3, variable->name() + "." + membertok->str(), Malloc);
                     }
                     break;
                 }
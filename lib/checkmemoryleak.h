@@ -39,6 +39,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 class Function;
 class Scope;
@@ -114,6 +115,12 @@ public:
      */
     static AllocType getReallocationType(const Token *tok2, unsigned int varid);
 
+    /**
+     * @brief Names of the functions and keywords that allocate or deallocate
+     * memory or resources. Without them there can be no leaks.
+     */
+    static std::vector<std::string> allocationNames(const Settings *settings);
+
     /**
      * @brief Is a typename the name of a class?
      * @param tok type token
@@ -170,6 +177,11 @@ public:
  * -# create a simple token list that describes the usage of the function variable.
  * -# simplify the token list.
  * -# finally, check if the simplified token list contain any leaks.
+ *
+ * Before that, a prefilter scans the function bodies once to find the variables that can
+ * get allocated memory: they are assigned the result of a function call / new or their
+ * address is taken. The other local variables are not checked. The steps above still
+ * run for each checked variable, there is no per-function summary.
  */
 
 class CPPCHECKLIB CheckMemoryLeakInFunction : private Check, public CheckMemoryLeak {
@@ -183,17 +195,21 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger), CheckMemoryLeak(tokenizer, errorLogger, settings) {
     }
 
-    /** @brief run all simplified checks */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckMemoryLeakInFunction checkMemoryLeak(tokenizer, settings, errorLogger);
         checkMemoryLeak.checkReallocUsage();
         checkMemoryLeak.check();
     }
 
+    std::vector<std::string> triggerNames(const Settings *settings) const override {
+        return allocationNames(settings);
+    }
+
     /** @brief Unit testing : testing the white list */
     static bool test_white_list(const std::string &funcname, const Settings *settings, bool cpp);
 
-    /** @brief Perform checking */
+    /** @brief Perform checking, local variables without an allocation event are skipped by a prefilter */
     void check();
 
     /**
@@ -323,14 +339,19 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger), CheckMemoryLeak(tokenizer, errorLogger, settings) {
     }
 
-    void runSimplifiedChecks(const Tokenizer *tokenizr, const Settings *settings, ErrorLogger *errLog) override {
-        if (!tokenizr->isCPP())
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errLog) override {
+        if (!tokenizer->isCPP())
             return;
 
-        CheckMemoryLeakInClass checkMemoryLeak(tokenizr, settings, errLog);
+        CheckMemoryLeakInClass checkMemoryLeak(tokenizer, settings, errLog);
         checkMemoryLeak.check();
     }
 
+    std::vector<std::string> triggerNames(const Settings *settings) const override {
+        return allocationNames(settings);
+    }
+
     void check();
 
 private:
@@ -370,11 +391,16 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger), CheckMemoryLeak(tokenizer, errorLogger, settings) {
     }
 
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckMemoryLeakStructMember checkMemoryLeak(tokenizer, settings, errorLogger);
         checkMemoryLeak.check();
     }
 
+    std::vector<std::string> triggerNames(const Settings *settings) const override {
+        return allocationNames(settings);
+    }
+
     void check();
 
 private:
@@ -409,11 +435,16 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger), CheckMemoryLeak(tokenizer, errorLogger, settings) {
     }
 
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckMemoryLeakNoVar checkMemoryLeak(tokenizer, settings, errorLogger);
         checkMemoryLeak.check();
     }
 
+    std::vector<std::string> triggerNames(const Settings *settings) const override {
+        return allocationNames(settings);
+    }
+
     void check();
 
 private:
@@ -23,6 +23,7 @@
 #include "errorlogger.h"
 #include "library.h"
 #include "settings.h"
+#include "summaries.h"
 #include "symboldatabase.h"
 #include "token.h"
 #include "tokenize.h"
@@ -56,7 +57,7 @@ static bool checkNullpointerFunctionCallPlausibility(const Function* func, unsig
  * @param var variables that the function read / write.
  * @param library --library files data
  */
-void CheckNullPointer::parseFunctionCall(const Token &tok, std::list<const Token *> &var, const Library *library)
+void CheckNullPointer::parseFunctionCall(const Token &tok, std::list<const Token *> &var, const Library *library, const Summaries *summaries)
 {
     if (Token::Match(&tok, "%name% ( )") || !tok.tokAt(2))
         return;
@@ -84,6 +85,17 @@ void CheckNullPointer::parseFunctionCall(const Token &tok, std::list<const Token
         }
     }
 
+    // Function defined in another translation unit?
+    Summaries::Function summary;
+    if (summaries && summaries->find(&tok, &summary)) {
+        const Token *param = firstParam;
+        for (unsigned int argnr = 1; param; ++argnr) {
+            if (summary.derefArgs.find(argnr) != summary.derefArgs.end() && std::find(var.begin(), var.end(), param) == var.end())
+                var.push_back(param);
+            param = param->nextArgument();
+        }
+    }
+
     if (Token::Match(&tok, "printf|sprintf|snprintf|fprintf|fnprintf|scanf|sscanf|fscanf|wprintf|swprintf|fwprintf|wscanf|swscanf|fwscanf")) {
         const Token* argListTok = nullptr; // Points to first va_list argument
         std::string formatString;
@@ -349,7 +361,7 @@ void CheckNullPointer::nullPointerByDeRefAndChec()
             if (!ftok || !ftok->previous())
                 continue;
             std::list<const Token *> varlist;
-            parseFunctionCall(*ftok->previous(), varlist, &mSettings->library);
+            parseFunctionCall(*ftok->previous(), varlist, &mSettings->library, &mSettings->summaries);
             if (std::find(varlist.begin(), varlist.end(), tok) != varlist.end()) {
                 nullPointerError(tok, tok->str(), value, value->isInconclusive());
             }
@@ -415,10 +427,11 @@ void CheckNullPointer::nullConstantDereference()
                         nullPointerError(tok);
                 } else { // function call
                     std::list<const Token *> var;
-                    parseFunctionCall(*tok, var, &mSettings->library);
+                    parseFunctionCall(*tok, var, &mSettings->library, &mSettings->summaries);
 
                     // is one of the var items a NULL pointer?
                     for (const Token *vartok : var) {
+                        vartok = skipCasts(vartok);
                         if (Token::Match(vartok, "0|NULL|nullptr [,)]")) {
                             nullPointerError(vartok);
                         }
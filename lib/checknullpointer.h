@@ -32,6 +32,7 @@
 class ErrorLogger;
 class Library;
 class Settings;
+class Summaries;
 class Token;
 class Tokenizer;
 
@@ -58,11 +59,7 @@ public:
         CheckNullPointer checkNullPointer(tokenizer, settings, errorLogger);
         checkNullPointer.nullPointer();
         checkNullPointer.arithmetic();
-    }
 
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckNullPointer checkNullPointer(tokenizer, settings, errorLogger);
         checkNullPointer.nullConstantDereference();
     }
 
@@ -71,10 +68,12 @@ public:
      * @param tok first token
      * @param var variables that the function read / write.
      * @param library --library files data
+     * @param summaries function summaries of other translation units
      */
     static void parseFunctionCall(const Token &tok,
                                   std::list<const Token *> &var,
-                                  const Library *library);
+                                  const Library *library,
+                                  const Summaries *summaries = nullptr);
 
     /**
      * Is there a pointer dereference? Everything that should result in
@@ -106,6 +105,7 @@ private:
         CheckNullPointer c(nullptr, settings, errorLogger);
         c.nullPointerError(nullptr, "pointer", nullptr, false);
         c.arithmeticError(nullptr, nullptr);
+        c.reportError(nullptr, Severity::warning, "nullPointerArithmeticRedundantCheck", "Either the condition is redundant or there is pointer arithmetic with NULL pointer.", CWE(682U), false);
     }
 
     /** Name of check */
@@ -1833,8 +1833,8 @@ void CheckOther::checkInvalidFree()
             // If a previously-allocated pointer is incremented or decremented, any subsequent
             // free involving pointer arithmetic may or may not be invalid, so we should only
             // report an inconclusive result.
-            else if (Token::Match(tok, "%var% = %name% +|-") &&
-                     tok->varId() == tok->tokAt(2)->varId() &&
+            else if (((Token::Match(tok, "%var% = %name% +|-") && tok->varId() == tok->tokAt(2)->varId()) ||
+                      Token::Match(tok, "%var% +=|-=|++|--") || Token::Match(tok->previous(), "++|-- %var%")) &&
                      allocatedVariables.find(tok->varId()) != allocatedVariables.end()) {
                 if (printInconclusive)
                     allocatedVariables[tok->varId()] = true;
@@ -1844,7 +1844,7 @@ void CheckOther::checkInvalidFree()
 
             // If a previously-allocated pointer is assigned a completely new value,
             // we can't know if any subsequent free() on that pointer is valid or not.
-            else if (Token::Match(tok, "%var% =")) {
+            else if (Token::Match(tok, "%var% %assign%")) {
                 allocatedVariables.erase(tok->varId());
             }
 
@@ -2079,9 +2079,12 @@ void CheckOther::duplicateAssignExpressionError(const Token *tok1, const Token *
 {
     const std::list<const Token *> toks = { tok2, tok1 };
 
+    const std::string var1 = tok1 ? tok1->str() : "x";
+    const std::string var2 = tok2 ? tok2->str() : "x";
+
     reportError(toks, Severity::style, "duplicateAssignExpression",
-                "Same expression used in consecutive assignments of '" + tok1->str() + "' and '" + tok2->str() + "'.\n"
-                "Finding variables '" + tok1->str() + "' and '" + tok2->str() + "' that are assigned the same expression "
+                "Same expression used in consecutive assignments of '" + var1 + "' and '" + var2 + "'.\n"
+                "Finding variables '" + var1 + "' and '" + var2 + "' that are assigned the same expression "
                 "is suspicious and might indicate a cut and paste or logic error. Please examine this code carefully to "
                 "determine if it is correct.", CWE398, false);
 }
@@ -81,13 +81,6 @@ public:
         checkOther.checkUnusedLabel();
         checkOther.checkEvaluationOrder();
         checkOther.checkFuncArgNamesDifferent();
-    }
-
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckOther checkOther(tokenizer, settings, errorLogger);
-
-        // Checks
         checkOther.clarifyCalculation();
         checkOther.clarifyStatement();
         checkOther.checkPassByReference();
@@ -104,6 +97,10 @@ public:
         checkOther.checkAccessOfMovedVariable();
     }
 
+    unsigned int valueFlowAnalyses() const override {
+        return ValueFlow::ANALYSIS_MOVED;
+    }
+
     /** @brief Clarify calculation for ".. a * b ? .." */
     void clarifyCalculation();
 
@@ -304,6 +301,7 @@ private:
         c.duplicateBranchError(nullptr, nullptr);
         c.oppositeExpressionError(nullptr, nullptr, "&&", errorPath);
         c.duplicateExpressionError(nullptr, nullptr, nullptr, errorPath);
+        c.duplicateAssignExpressionError(nullptr, nullptr);
         c.duplicateValueTernaryError(nullptr);
         c.duplicateExpressionTernaryError(nullptr);
         c.duplicateBreakError(nullptr,  false);
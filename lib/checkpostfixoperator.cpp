@@ -48,27 +48,26 @@ void CheckPostfixOperator::postfixOperator()
     if (!mSettings->isEnabled(Settings::PERFORMANCE))
         return;
 
-    const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
-
-    for (const Scope * scope : symbolDatabase->functionScopes) {
-        for (const Token* tok = scope->bodyStart->next(); tok != scope->bodyEnd; tok = tok->next()) {
-            const Variable *var = tok->variable();
-            if (!var || !Token::Match(tok, "%var% ++|--"))
-                continue;
-
-            const Token* parent = tok->next()->astParent();
-            if (!parent || parent->str() == ";" || (parent->str() == "," && (!parent->astParent() || parent->astParent()->str() != "("))) {
-                if (var->isPointer() || var->isArray())
-                    continue;
-
-                if (Token::Match(var->nameToken()->previous(), "iterator|const_iterator|reverse_iterator|const_reverse_iterator")) {
-                    // the variable is an iterator
-                    postfixOperatorError(tok);
-                } else if (var->type()) {
-                    // the variable is an instance of class
-                    postfixOperatorError(tok);
-                }
-            }
+    TokenVisitor::walk(mTokenizer, std::vector<TokenVisitor *>(1, this));
+}
+
+void CheckPostfixOperator::visitToken(const Token *tok)
+{
+    const Variable *var = tok->variable();
+    if (!var || !Token::Match(tok, "%var% ++|--"))
+        return;
+
+    const Token* parent = tok->next()->astParent();
+    if (!parent || parent->str() == ";" || (parent->str() == "," && (!parent->astParent() || parent->astParent()->str() != "("))) {
+        if (var->isPointer() || var->isArray())
+            return;
+
+        if (Token::Match(var->nameToken()->previous(), "iterator|const_iterator|reverse_iterator|const_reverse_iterator")) {
+            // the variable is an iterator
+            postfixOperatorError(tok);
+        } else if (var->type()) {
+            // the variable is an instance of class
+            postfixOperatorError(tok);
         }
     }
 }
@@ -39,7 +39,7 @@ class Token;
  * @brief Using postfix operators ++ or -- rather than postfix operator.
  */
 
-class CPPCHECKLIB CheckPostfixOperator : public Check {
+class CPPCHECKLIB CheckPostfixOperator : public Check, private TokenVisitor {
 public:
     /** This constructor is used when registering the CheckPostfixOperator */
     CheckPostfixOperator() : Check(myName()) {
@@ -57,13 +57,23 @@ public:
         CheckPostfixOperator checkPostfixOperator(tokenizer, settings, errorLogger);
         checkPostfixOperator.postfixOperator();
     }
-    void runSimplifiedChecks(const Tokenizer * /*tokenizer*/, const Settings * /*settings*/, ErrorLogger * /*errorLogger*/) override {
+
+    TokenVisitor * createTokenVisitor(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) const override {
+        if (tokenizer->isC() || !settings->isEnabled(Settings::PERFORMANCE))
+            return nullptr;
+        return new CheckPostfixOperator(tokenizer, settings, errorLogger);
     }
 
     /** Check postfix operators */
     void postfixOperator();
 
 private:
+    unsigned int events() const override {
+        return TOKEN;
+    }
+
+    void visitToken(const Token *tok) override;
+
     /** Report Error */
     void postfixOperatorError(const Token *tok);
 
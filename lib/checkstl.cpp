@@ -1445,9 +1445,10 @@ void CheckStl::checkAutoPointer()
                     if (Token::Match(tok3, "( new %type%") && hasArrayEndParen(tok3)) {
                         autoPointerArrayError(tok2->next());
                     }
-                    if (Token::Match(tok3, "( %name% (") && malloc && mSettings->library.alloc(tok3->next(), -1) == malloc) {
+                    const Token *argtok = (tok3 && tok3->str() == "(") ? skipCasts(tok3->next()) : nullptr;
+                    if (Token::Match(argtok, "%name% (") && malloc && mSettings->library.alloc(argtok, -1) == malloc) {
                         // malloc-like function allocated memory passed to the auto_ptr constructor -> error
-                        autoPointerMallocError(tok2->next(), tok3->next()->str());
+                        autoPointerMallocError(tok2->next(), argtok->str());
                     }
                     if (Token::Match(tok3, "( %var%")) {
                         const std::map<unsigned int, const std::string>::const_iterator it = mallocVarId.find(tok3->next()->varId());
@@ -1489,20 +1490,21 @@ void CheckStl::checkAutoPointer()
                 if (iter != autoPtrVarId.end()) {
                     autoPointerArrayError(tok);
                 }
-            } else if (Token::Match(tok, "%var% = %name% (") && malloc && mSettings->library.alloc(tok->tokAt(2), -1) == malloc) {
+            } else if (Token::Match(tok, "%var% =") && Token::Match(skipCasts(tok->tokAt(2)), "%name% (") && malloc && mSettings->library.alloc(skipCasts(tok->tokAt(2)), -1) == malloc) {
                 // C library function like 'malloc' used together with auto pointer -> error
+                const std::string &allocFunction = skipCasts(tok->tokAt(2))->str();
                 const std::set<unsigned int>::const_iterator iter = autoPtrVarId.find(tok->varId());
                 if (iter != autoPtrVarId.end()) {
-                    autoPointerMallocError(tok, tok->strAt(2));
+                    autoPointerMallocError(tok, allocFunction);
                 } else if (tok->varId()) {
                     // it is not an auto pointer variable and it is allocated by malloc like function.
-                    mallocVarId.insert(std::make_pair(tok->varId(), tok->strAt(2)));
+                    mallocVarId.insert(std::make_pair(tok->varId(), allocFunction));
                 }
-            } else if (Token::Match(tok, "%var% . reset ( %name% (") && malloc && mSettings->library.alloc(tok->tokAt(4), -1) == malloc) {
+            } else if (Token::Match(tok, "%var% . reset (") && Token::Match(skipCasts(tok->tokAt(4)), "%name% (") && malloc && mSettings->library.alloc(skipCasts(tok->tokAt(4)), -1) == malloc) {
                 // C library function like 'malloc' used when resetting auto pointer -> error
                 const std::set<unsigned int>::const_iterator iter = autoPtrVarId.find(tok->varId());
                 if (iter != autoPtrVarId.end()) {
-                    autoPointerMallocError(tok, tok->strAt(4));
+                    autoPointerMallocError(tok, skipCasts(tok->tokAt(4))->str());
                 }
             }
         }
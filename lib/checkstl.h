@@ -61,15 +61,6 @@ public:
 
         CheckStl checkStl(tokenizer, settings, errorLogger);
         checkStl.outOfBounds();
-    }
-
-    /** Simplified checks. The token list is simplified. */
-    void runSimplifiedChecks(const Tokenizer* tokenizer, const Settings* settings, ErrorLogger* errorLogger) override {
-        if (!tokenizer->isCPP()) {
-            return;
-        }
-
-        CheckStl checkStl(tokenizer, settings, errorLogger);
 
         checkStl.stlOutOfBounds();
         checkStl.negativeIndex();
@@ -91,6 +82,10 @@ public:
         checkStl.readingEmptyStlContainer();
     }
 
+    unsigned int valueFlowAnalyses() const override {
+        return ValueFlow::ANALYSIS_CONTAINER_SIZE;
+    }
+
     /** Accessing container out of bounds using ValueFlow */
     void outOfBounds();
 
@@ -58,13 +58,6 @@ public:
         checkString.checkSuspiciousStringCompare();
         checkString.stringLiteralWrite();
         checkString.overlappingStrcmp();
-    }
-
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        CheckString checkString(tokenizer, settings, errorLogger);
-
-        // Checks
         checkString.checkIncorrectStringCompare();
         checkString.checkAlwaysTrueOrFalseStringCompare();
         checkString.sprintfOverlappingData();
@@ -59,13 +59,6 @@ public:
         checkType.checkFloatToIntegerOverflow();
     }
 
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
-        (void)tokenizer;
-        (void)settings;
-        (void)errorLogger;
-    }
-
     /** @brief %Check for bitwise shift with too big right operand */
     void checkTooBigBitwiseShift();
 
@@ -96,6 +89,7 @@ private:
         c.tooBigBitwiseShiftError(nullptr, 32, ValueFlow::Value(64));
         c.tooBigSignedBitwiseShiftError(nullptr, 31, ValueFlow::Value(31));
         c.integerOverflowError(nullptr, ValueFlow::Value(1LL<<32));
+        c.reportError(nullptr, Severity::warning, "integerOverflowCond", "Either the condition is redundant or there is signed integer overflow for expression ''.", CWE(190U), false);
         c.signConversionError(nullptr, false);
         c.longCastAssignError(nullptr);
         c.longCastReturnError(nullptr);
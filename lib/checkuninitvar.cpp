@@ -22,6 +22,7 @@
 
 #include "astutils.h"
 #include "checknullpointer.h"   // CheckNullPointer::isPointerDeref
+#include "controlflow.h"
 #include "errorlogger.h"
 #include "library.h"
 #include "mathlib.h"
@@ -39,6 +40,7 @@
 #include <map>
 #include <stack>
 #include <utility>
+#include <vector>
 //---------------------------------------------------------------------------
 
 // Register this check class (by creating a static instance of it)
@@ -54,10 +56,214 @@ static const struct CWE CWE676(676U);
 static const struct CWE CWE908(908U);
 static const struct CWE CWE825(825U);
 
+namespace {
+    /** @brief Set of variables, one bit per variable */
+    class VariableSet {
+    public:
+        VariableSet(std::size_t size, bool value) : mBits((size + BITS - 1U) / BITS, value ? ~0UL : 0UL) {}
+
+        bool test(std::size_t bit) const {
+            return ((mBits[bit / BITS] >> (bit % BITS)) & 1UL) != 0;
+        }
+        void set(std::size_t bit) {
+            mBits[bit / BITS] |= (1UL << (bit % BITS));
+        }
+        void reset(std::size_t bit) {
+            mBits[bit / BITS] &= ~(1UL << (bit % BITS));
+        }
+        void intersect(const VariableSet &other) {
+            for (std::size_t i = 0; i < mBits.size(); ++i)
+                mBits[i] &= other.mBits[i];
+        }
+        bool operator==(const VariableSet &other) const {
+            return mBits == other.mBits;
+        }
+    private:
+        static const std::size_t BITS = sizeof(unsigned long) * 8U;
+        std::vector<unsigned long> mBits;
+    };
+
+    /**
+     * @brief Forward dataflow over the control flow graph of a function that
+     * tracks which local variables are initialized, for all variables at once.
+     *
+     * A variable is "safe" if every usage happens where it is initialized on
+     * all paths. Such variables can't be used uninitialized, so the more
+     * detailed token walk in checkScopeForVariable can be skipped for them.
+     */
+    class InitializedVariables {
+    public:
+        InitializedVariables(const ControlFlowGraph &cfg, const Library &library)
+            : mCfg(cfg), mLibrary(library) {
+            const Scope *scope = cfg.scope();
+            for (const Token *tok = scope->bodyStart; tok != scope->bodyEnd; tok = tok->next()) {
+                if (!tok->varId())
+                    continue;
+                const Variable *var = tok->variable();
+                if (var && var->nameToken() == tok && var->isLocal() && !var->isStatic()) {
+                    mBitIndex[tok->varId()] = mVariables.size();
+                    mVariables.push_back(var);
+                    mUsages.push_back(0);
+                } else {
+                    const std::map<unsigned int, std::size_t>::const_iterator it = mBitIndex.find(tok->varId());
+                    if (it != mBitIndex.end())
+                        ++mUsages[it->second];
+                }
+            }
+        }
+
+        /** Mark the variables that are initialized before every usage */
+        void getSafeVariables(std::vector<bool> *safe) {
+            if (mVariables.empty())
+                return;
+            const std::vector<ControlFlowGraph::BasicBlock> &blocks = mCfg.blocks();
+            const std::size_t size = mVariables.size();
+
+            // at the entry no variable is initialized
+            std::vector<VariableSet> in(blocks.size(), VariableSet(size, true));
+            std::vector<VariableSet> out(blocks.size(), VariableSet(size, true));
+            in[mCfg.entry().index] = out[mCfg.entry().index] = VariableSet(size, false);
+
+            std::vector<bool> visited(blocks.size(), false);
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (std::size_t i = 0; i < blocks.size(); ++i) {
+                    const ControlFlowGraph::BasicBlock &block = blocks[i];
+                    if (block.index == mCfg.entry().index || !mCfg.isReachable(block.index))
+                        continue;
+                    VariableSet state(size, true);
+                    for (std::vector<ControlFlowGraph::Edge>::const_iterator edge = block.predecessors.begin(); edge != block.predecessors.end(); ++edge) {
+                        // an exception can be thrown before the statements in the block are executed
+                        if (mCfg.isReachable(edge->block))
+                            state.intersect(edge->type == ControlFlowGraph::EXCEPTION ? in[edge->block] : out[edge->block]);
+                    }
+                    if (visited[i] && state == in[i])
+                        continue;
+                    visited[i] = true;
+                    in[i] = state;
+                    for (std::vector<ControlFlowGraph::Statement>::const_iterator stmt = block.statements.begin(); stmt != block.statements.end(); ++stmt)
+                        transfer(stmt->start, stmt->end, &state, nullptr, nullptr);
+                    if (!(state == out[i])) {
+                        out[i] = state;
+                        changed = true;
+                    }
+                }
+            }
+
+            // check all usages with the final states
+            VariableSet unsafe(size, false);
+            std::vector<unsigned int> seen(size, 0);
+            for (std::size_t i = 0; i < blocks.size(); ++i) {
+                if (!mCfg.isReachable(blocks[i].index))
+                    continue;
+                VariableSet state = in[i];
+                for (std::vector<ControlFlowGraph::Statement>::const_iterator stmt = blocks[i].statements.begin(); stmt != blocks[i].statements.end(); ++stmt)
+                    transfer(stmt->start, stmt->end, &state, &unsafe, &seen);
+            }
+
+            for (std::size_t bit = 0; bit < size; ++bit) {
+                // usages that are not in a reachable statement are not analysed
+                if (!unsafe.test(bit) && seen[bit] == mUsages[bit])
+                    (*safe)[mVariables[bit]->declarationId()] = true;
+            }
+        }
+
+    private:
+        /** Is the variable initialized by the assignment "var = rhs;"? */
+        bool isInitialization(const Token *vartok, const Variable *var) const {
+            const Token *assign = vartok->astParent();
+            if (!assign || assign->str() != "=" || assign->astOperand1() != vartok)
+                return false;
+
+            // the pointer is assigned but the data it points at is not initialized
+            if (var->isPointer()) {
+                const Token *rhs = skipCasts(assign->next());
+                if (!rhs || rhs->str() == "new" || (Token::Match(rhs, "%name% (") && mLibrary.returnuninitdata.count(rhs->str()) > 0U))
+                    return false;
+            }
+
+            while (Token::simpleMatch(assign->astParent(), "="))
+                assign = assign->astParent();
+            if (!assign->astParent())
+                return true;
+
+            // for (var = 0; ...
+            const Token *parent = assign->astParent();
+            return parent->str() == ";" && parent->astOperand1() == assign && Token::simpleMatch(parent->astParent(), "(") &&
+                   Token::simpleMatch(parent->astParent()->previous(), "for (");
+        }
+
+        /** Is the variable declared in a range for loop "for (var : range)"? */
+        static bool isRangeForVariable(const Token *vartok) {
+            const Token *colon = vartok->astParent();
+            return colon && colon->str() == ":" && colon->astOperand1() == vartok &&
+                   Token::simpleMatch(colon->astParent(), "(") && Token::simpleMatch(colon->astParent()->previous(), "for (");
+        }
+
+        /** Bit of variable or size of set if it's not a local variable */
+        std::size_t bit(const Token *tok) const {
+            if (!tok->varId())
+                return mVariables.size();
+            const std::map<unsigned int, std::size_t>::const_iterator it = mBitIndex.find(tok->varId());
+            return (it != mBitIndex.end()) ? it->second : mVariables.size();
+        }
+
+        /** Update state for the statement "start .. end". Usages of variables that might not be initialized are added to unsafe. */
+        void transfer(const Token *start, const Token *end, VariableSet *state, VariableSet *unsafe, std::vector<unsigned int> *seen) const {
+            std::vector<std::size_t> declared, assigned;
+            for (const Token *tok = start; tok && tok != end; tok = tok->next()) {
+                // lambda, initializer list => don't try to handle the code in the braces
+                if (tok->str() == "{") {
+                    for (const Token *tok2 = tok->next(); tok2 != tok->link(); tok2 = tok2->next()) {
+                        const std::size_t b = bit(tok2);
+                        if (b < mVariables.size() && unsafe)
+                            unsafe->set(b);
+                        if (b < mVariables.size() && seen && tok2 != mVariables[b]->nameToken())
+                            ++(*seen)[b];
+                    }
+                    tok = tok->link();
+                    continue;
+                }
+
+                const std::size_t b = bit(tok);
+                if (b >= mVariables.size())
+                    continue;
+                if (tok == mVariables[b]->nameToken()) {
+                    // the declaration in "for (int i = 0; ..." and "for (int x : v)" is not split
+                    declared.push_back(b);
+                    if (isInitialization(tok, mVariables[b]) || isRangeForVariable(tok))
+                        assigned.push_back(b);
+                    continue;
+                }
+                if (isInitialization(tok, mVariables[b]))
+                    assigned.push_back(b);
+                else if (unsafe && !state->test(b))
+                    unsafe->set(b);
+                if (seen)
+                    ++(*seen)[b];
+            }
+            for (std::vector<std::size_t>::const_iterator it = declared.begin(); it != declared.end(); ++it)
+                state->reset(*it);
+            for (std::vector<std::size_t>::const_iterator it = assigned.begin(); it != assigned.end(); ++it)
+                state->set(*it);
+        }
+
+        const ControlFlowGraph &mCfg;
+        const Library &mLibrary;
+        std::map<unsigned int, std::size_t> mBitIndex;
+        std::vector<const Variable *> mVariables;
+        std::vector<unsigned int> mUsages;
+    };
+}
+
 void CheckUninitVar::check()
 {
     const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
 
+    std::vector<bool> initialized;
+    getInitializedVariables(&initialized);
+
     std::set<std::string> arrayTypeDefs;
     for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
         if (Token::Match(tok, "%name% [") && tok->variable() && Token::Match(tok->variable()->typeStartToken(), "%type% %var% ;"))
@@ -65,16 +271,27 @@ void CheckUninitVar::check()
     }
 
     // check every executable scope
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (ChunkedList<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (scope->isExecutable()) {
-            checkScope(&*scope, arrayTypeDefs);
+            checkScope(&*scope, arrayTypeDefs, initialized);
         }
     }
 }
 
-void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs)
+void CheckUninitVar::getInitializedVariables(std::vector<bool> *initialized) const
 {
-    for (std::list<Variable>::const_iterator i = scope->varlist.begin(); i != scope->varlist.end(); ++i) {
+    const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
+    initialized->assign(symbolDatabase->variableList().size(), false);
+    for (std::size_t i = 0; i < symbolDatabase->functionScopes.size(); ++i) {
+        const ControlFlowGraph *cfg = symbolDatabase->getControlFlowGraph(symbolDatabase->functionScopes[i]);
+        if (cfg)
+            InitializedVariables(*cfg, mSettings->library).getSafeVariables(initialized);
+    }
+}
+
+void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs, const std::vector<bool> &initialized)
+{
+    for (ChunkedList<Variable>::const_iterator i = scope->varlist.begin(); i != scope->varlist.end(); ++i) {
         if ((mTokenizer->isCPP() && i->type() && !i->isPointer() && i->type()->needInitialization != Type::True) ||
             i->isStatic() || i->isExtern() || i->isReference())
             continue;
@@ -83,6 +300,10 @@ void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string>
         if (i->isThrow())
             continue;
 
+        // variable is initialized before every usage
+        if (i->declarationId() < initialized.size() && initialized[i->declarationId()])
+            continue;
+
         if (Token::Match(i->nameToken()->next(), "[({:]"))
             continue;
 
@@ -167,7 +388,7 @@ void CheckUninitVar::checkStruct(const Token *tok, const Variable &structvar)
     for (std::size_t j = 0U; j < symbolDatabase->classAndStructScopes.size(); ++j) {
         const Scope *scope2 = symbolDatabase->classAndStructScopes[j];
         if (scope2->className == typeToken->str() && scope2->numConstructors == 0U) {
-            for (std::list<Variable>::const_iterator it = scope2->varlist.begin(); it != scope2->varlist.end(); ++it) {
+            for (ChunkedList<Variable>::const_iterator it = scope2->varlist.begin(); it != scope2->varlist.end(); ++it) {
                 const Variable &var = *it;
 
                 if (var.hasDefault() || var.isArray() || (!mTokenizer->isC() && var.isClass() && (!var.type() || var.type()->needInitialization != Type::True)))
@@ -654,9 +875,10 @@ bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var
         if (tok->varId() == var.declarationId()) {
             // calling function that returns uninit data through pointer..
             if (var.isPointer() &&
-                Token::Match(tok->next(), "= %name% (") &&
-                Token::simpleMatch(tok->linkAt(3), ") ;") &&
-                mSettings->library.returnuninitdata.count(tok->strAt(2)) > 0U) {
+                Token::simpleMatch(tok->next(), "=") &&
+                Token::Match(skipCasts(tok->tokAt(2)), "%name% (") &&
+                Token::simpleMatch(skipCasts(tok->tokAt(2))->linkAt(1), ") ;") &&
+                mSettings->library.returnuninitdata.count(skipCasts(tok->tokAt(2))->str()) > 0U) {
                 *alloc = NO_CTOR_CALL;
                 continue;
             }
@@ -1027,6 +1249,13 @@ bool CheckUninitVar::isVariableUsage(const Token *vartok, bool pointer, Alloc al
     if (alloc == NO_ALLOC && vartok->next() && vartok->next()->isOp() && !vartok->next()->isAssignmentOp())
         return true;
 
+    // compound assignment: "x += 1" and "y += x" both read x
+    if (alloc == NO_ALLOC && (Token::Match(vartok, "%name% %assign%") || Token::Match(vartok->previous(), "%assign% %name%"))) {
+        const Token *assignTok = vartok->next()->isAssignmentOp() ? vartok->next() : vartok->previous();
+        if (assignTok->str() != "=")
+            return true;
+    }
+
     if (vartok->strAt(1) == "]")
         return true;
 
@@ -1230,7 +1459,7 @@ void CheckUninitVar::valueFlowUninit()
     const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
 
     // check every executable scope
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (ChunkedList<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (!scope->isExecutable())
             continue;
         for (const Token* tok = scope->bodyStart; tok != scope->bodyEnd; tok = tok->next()) {
@@ -1255,7 +1484,7 @@ void CheckUninitVar::deadPointer()
     const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
 
     // check every executable scope
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (ChunkedList<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (!scope->isExecutable())
             continue;
         // Dead pointers..
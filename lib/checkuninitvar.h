@@ -27,6 +27,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 class ErrorLogger;
 class Scope;
@@ -59,17 +60,24 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger) {
     }
 
-    /** @brief Run checks against the simplified token list */
-    void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckUninitVar checkUninitVar(tokenizer, settings, errorLogger);
         checkUninitVar.check();
         checkUninitVar.deadPointer();
         checkUninitVar.valueFlowUninit();
     }
 
+    unsigned int valueFlowAnalyses() const override {
+        return ValueFlow::ANALYSIS_UNINIT;
+    }
+
     /** Check for uninitialized variables */
     void check();
-    void checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs);
+
+    /** Get the local variables that are initialized before every usage, indexed by declaration id. These are found in a single dataflow pass per function. */
+    void getInitializedVariables(std::vector<bool> *initialized) const;
+    void checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs, const std::vector<bool> &initialized);
     void checkStruct(const Token *tok, const Variable &structvar);
     enum Alloc { NO_ALLOC, NO_CTOR_CALL, CTOR_CALL, ARRAY };
     bool checkScopeForVariable(const Token *tok, const Variable& var, bool* const possibleInit, bool* const noreturn, Alloc* const alloc, const std::string &membervar, std::map<unsigned int, VariableValue> variableValue);
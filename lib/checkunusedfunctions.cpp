@@ -20,6 +20,7 @@
 //---------------------------------------------------------------------------
 #include "checkunusedfunctions.h"
 
+#include "analyzerinfo.h"
 #include "errorlogger.h"
 #include "library.h"
 #include "settings.h"
@@ -28,11 +29,10 @@
 #include "tokenize.h"
 #include "tokenlist.h"
 
-#include <tinyxml2.h>
 #include <algorithm>
 #include <cstdlib>
-#include <cstring>
 #include <istream>
+#include <sstream>
 #include <utility>
 //---------------------------------------------------------------------------
 
@@ -359,15 +359,12 @@ CheckUnusedFunctions::FunctionDecl::FunctionDecl(const Function *f)
 
 std::string CheckUnusedFunctions::analyzerInfo() const
 {
+    // one line per declaration "decl <line> <name>" and per call "call <name>"
     std::ostringstream ret;
-    for (std::list<FunctionDecl>::const_iterator it = mFunctionDecl.begin(); it != mFunctionDecl.end(); ++it) {
-        ret << "    <functiondecl"
-            << " functionName=\"" << ErrorLogger::toxml(it->functionName) << '\"'
-            << " lineNumber=\"" << it->lineNumber << "\"/>\n";
-    }
-    for (std::set<std::string>::const_iterator it = mFunctionCalls.begin(); it != mFunctionCalls.end(); ++it) {
-        ret << "    <functioncall functionName=\"" << ErrorLogger::toxml(*it) << "\"/>\n";
-    }
+    for (std::list<FunctionDecl>::const_iterator it = mFunctionDecl.begin(); it != mFunctionDecl.end(); ++it)
+        ret << "decl " << it->lineNumber << ' ' << it->functionName << '\n';
+    for (std::set<std::string>::const_iterator it = mFunctionCalls.begin(); it != mFunctionCalls.end(); ++it)
+        ret << "call " << *it << '\n';
     return ret.str();
 }
 
@@ -385,46 +382,20 @@ void CheckUnusedFunctions::analyseWholeProgram(ErrorLogger * const errorLogger,
     std::map<std::string, Location> decls;
     std::set<std::string> calls;
 
-    const std::string filesTxt(buildDir + "/files.txt");
-    std::ifstream fin(filesTxt.c_str());
-    std::string filesTxtLine;
-    while (std::getline(fin, filesTxtLine)) {
-        const std::string::size_type firstColon = filesTxtLine.find(':');
-        if (firstColon == std::string::npos)
-            continue;
-        const std::string::size_type secondColon = filesTxtLine.find(':', firstColon+1);
-        if (secondColon == std::string::npos)
-            continue;
-        const std::string xmlfile = buildDir + '/' + filesTxtLine.substr(0,firstColon);
-        const std::string sourcefile = filesTxtLine.substr(secondColon+1);
-
-        tinyxml2::XMLDocument doc;
-        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
-        if (error != tinyxml2::XML_SUCCESS)
+    std::list<AnalyzerInformation::FileInfo> fileInfo;
+    AnalyzerInformation::getFileInfo(buildDir, &fileInfo);
+    for (const AnalyzerInformation::FileInfo &checkInfo : fileInfo) {
+        if (checkInfo.check != "CheckUnusedFunctions")
             continue;
-
-        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
-        if (rootNode == nullptr)
-            continue;
-
-        for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-            if (std::strcmp(e->Name(), "FileInfo") != 0)
-                continue;
-            const char *checkattr = e->Attribute("check");
-            if (checkattr == nullptr || std::strcmp(checkattr,"CheckUnusedFunctions") != 0)
-                continue;
-            for (const tinyxml2::XMLElement *e2 = e->FirstChildElement(); e2; e2 = e2->NextSiblingElement()) {
-                const char* functionName = e2->Attribute("functionName");
-                if (functionName == nullptr)
-                    continue;
-                if (std::strcmp(e2->Name(),"functioncall") == 0) {
-                    calls.insert(functionName);
-                    continue;
-                } else if (std::strcmp(e2->Name(),"functiondecl") == 0) {
-                    const char* lineNumber = e2->Attribute("lineNumber");
-                    if (lineNumber)
-                        decls[functionName] = Location(sourcefile, std::atoi(lineNumber));
-                }
+        std::istringstream istr(checkInfo.data);
+        std::string line;
+        while (std::getline(istr, line)) {
+            if (line.compare(0, 5, "call ") == 0) {
+                calls.insert(line.substr(5));
+            } else if (line.compare(0, 5, "decl ") == 0) {
+                const std::string::size_type pos = line.find(' ', 5);
+                if (pos != std::string::npos)
+                    decls[line.substr(pos + 1)] = Location(checkInfo.sourcefile, std::atoi(line.c_str() + 5));
             }
         }
     }
@@ -26,6 +26,7 @@
 #include "config.h"
 
 #include <string>
+#include <vector>
 
 class ErrorLogger;
 class Settings;
@@ -48,12 +49,17 @@ public:
         : Check(myName(), tokenizer, settings, errorLogger) {
     }
 
-    virtual void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
+    /** @brief Run checks against the normal token list */
+    virtual void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) override {
         CheckVaarg check(tokenizer, settings, errorLogger);
         check.va_start_argument();
         check.va_list_usage();
     }
 
+    std::vector<std::string> triggerNames(const Settings * /*settings*/) const override {
+        return { "va_start", "va_list" };
+    }
+
     void va_start_argument();
     void va_list_usage();
 
@@ -0,0 +1,273 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef chunkedlistH
+#define chunkedlistH
+//---------------------------------------------------------------------------
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Sequence container for the symbol database.
+ *
+ * Elements are stored in chunks of contiguous memory. The first chunk
+ * has room for 4 elements and each following chunk is twice as large
+ * as the one before. Chunks are never moved, so pointers and references
+ * to elements stay valid until the element is removed, like in a
+ * std::list, but without one allocation per element.
+ *
+ * Only appending and removing the last element is supported.
+ */
+template<class T>
+class ChunkedList {
+public:
+    typedef T value_type;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template<class V>
+    class Iterator {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef V *pointer;
+        typedef V &reference;
+
+        Iterator() : mList(nullptr), mIndex(0), mPtr(nullptr), mChunkEnd(nullptr) {}
+
+        // iterator => const_iterator
+        template<class V2>
+        Iterator(const Iterator<V2> &other) : mList(other.mList), mIndex(other.mIndex), mPtr(other.mPtr), mChunkEnd(other.mChunkEnd) {}
+
+        reference operator*() const {
+            return *get();
+        }
+        pointer operator->() const {
+            return get();
+        }
+
+        Iterator &operator++() {
+            ++mIndex;
+            if (mPtr != mChunkEnd)
+                ++mPtr;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator ret(*this);
+            ++*this;
+            return ret;
+        }
+        Iterator &operator--() {
+            --mIndex;
+            mPtr = mChunkEnd = nullptr;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator ret(*this);
+            --*this;
+            return ret;
+        }
+
+        template<class V2>
+        bool operator==(const Iterator<V2> &other) const {
+            return mIndex == other.mIndex;
+        }
+        template<class V2>
+        bool operator!=(const Iterator<V2> &other) const {
+            return mIndex != other.mIndex;
+        }
+
+    private:
+        friend class ChunkedList;
+        template<class V2> friend class Iterator;
+
+        Iterator(const ChunkedList *list, std::size_t index) : mList(list), mIndex(index), mPtr(nullptr), mChunkEnd(nullptr) {}
+
+        /** The element pointer is looked up when the iterator enters a new chunk */
+        pointer get() const {
+            if (mPtr == mChunkEnd) {
+                const std::size_t chunk = chunkOf(mIndex);
+                T *start = mList->mChunks[chunk];
+                mPtr = start + (mIndex - chunkStart(chunk));
+                mChunkEnd = start + chunkSize(chunk);
+            }
+            return mPtr;
+        }
+
+        const ChunkedList *mList;
+        std::size_t mIndex;
+        mutable pointer mPtr;
+        mutable pointer mChunkEnd;
+    };
+
+    typedef Iterator<T> iterator;
+    typedef Iterator<const T> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    ChunkedList() : mSize(0) {}
+
+    ChunkedList(const ChunkedList &other) : mSize(0) {
+        for (const T &t : other)
+            push_back(t);
+    }
+
+    ChunkedList(ChunkedList &&other) : mSize(0) {
+        swap(other);
+    }
+
+    ~ChunkedList() {
+        clear();
+        for (T *chunk : mChunks)
+            ::operator delete(chunk);
+    }
+
+    ChunkedList &operator=(ChunkedList other) {
+        swap(other);
+        return *this;
+    }
+
+    void swap(ChunkedList &other) {
+        mChunks.swap(other.mChunks);
+        std::swap(mSize, other.mSize);
+    }
+
+    std::size_t size() const {
+        return mSize;
+    }
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    iterator begin() {
+        return iterator(this, 0);
+    }
+    iterator end() {
+        return iterator(this, mSize);
+    }
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+    const_iterator end() const {
+        return const_iterator(this, mSize);
+    }
+    const_iterator cbegin() const {
+        return begin();
+    }
+    const_iterator cend() const {
+        return end();
+    }
+    reverse_iterator rbegin() {
+        return reverse_iterator(end());
+    }
+    reverse_iterator rend() {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    T &front() {
+        return *mChunks[0];
+    }
+    const T &front() const {
+        return *mChunks[0];
+    }
+    T &back() {
+        return *at(mSize - 1);
+    }
+    const T &back() const {
+        return *at(mSize - 1);
+    }
+
+    void push_back(const T &t) {
+        new (allocate()) T(t);
+        ++mSize;
+    }
+    void push_back(T &&t) {
+        new (allocate()) T(std::move(t));
+        ++mSize;
+    }
+    template<class... Args>
+    void emplace_back(Args &&... args) {
+        new (allocate()) T(std::forward<Args>(args)...);
+        ++mSize;
+    }
+
+    /** Remove the last element. The memory is kept for the next element. */
+    void pop_back() {
+        --mSize;
+        at(mSize)->~T();
+    }
+
+    void clear() {
+        while (mSize > 0)
+            pop_back();
+    }
+
+private:
+    enum { FIRST_CHUNK_SIZE = 4 };
+
+    static std::size_t chunkOf(std::size_t index) {
+        std::size_t n = index / FIRST_CHUNK_SIZE + 1;
+        std::size_t chunk = 0;
+        while (n >>= 1)
+            ++chunk;
+        return chunk;
+    }
+    static std::size_t chunkStart(std::size_t chunk) {
+        return FIRST_CHUNK_SIZE * ((std::size_t(1) << chunk) - 1);
+    }
+    static std::size_t chunkSize(std::size_t chunk) {
+        return FIRST_CHUNK_SIZE * (std::size_t(1) << chunk);
+    }
+
+    T *at(std::size_t index) const {
+        const std::size_t chunk = chunkOf(index);
+        return mChunks[chunk] + (index - chunkStart(chunk));
+    }
+
+    /** memory for the element at index mSize */
+    T *allocate() {
+        const std::size_t chunk = chunkOf(mSize);
+        if (chunk == mChunks.size())
+            mChunks.push_back(static_cast<T *>(::operator new(chunkSize(chunk) * sizeof(T))));
+        return mChunks[chunk] + (mSize - chunkStart(chunk));
+    }
+
+    std::vector<T *> mChunks;
+    std::size_t mSize;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // chunkedlistH
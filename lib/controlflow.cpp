@@ -0,0 +1,422 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#include "controlflow.h"
+
+#include "library.h"
+#include "mathlib.h"
+#include "symboldatabase.h"
+#include "token.h"
+
+#include <sstream>
+//---------------------------------------------------------------------------
+
+/** Get the end of the statement that starts at tok: the ";" or the end of the scope */
+static const Token *findStatementEnd(const Token *tok)
+{
+    for (; tok; tok = tok->next()) {
+        if (Token::Match(tok, "(|[|{"))
+            tok = tok->link();
+        else if (Token::Match(tok, ";|}"))
+            return tok;
+    }
+    return nullptr;
+}
+
+static bool isKnownTrue(const Token *condition)
+{
+    return condition && (condition->str() == "true" || (condition->isNumber() && !MathLib::isNullValue(condition->str())));
+}
+
+static bool isKnownFalse(const Token *condition)
+{
+    return condition && (condition->str() == "false" || (condition->isNumber() && MathLib::isNullValue(condition->str())));
+}
+
+ControlFlowGraph::ControlFlowGraph(const Scope *functionScope, const Library *library)
+    : mScope(functionScope), mLibrary(library)
+{
+    newBlock(); // entry
+    newBlock(); // exit
+
+    const unsigned int first = newBlock();
+    addEdge(ENTRY, first, FALLTHROUGH);
+    const unsigned int last = build(mScope->bodyStart->next(), mScope->bodyEnd, first);
+    addEdge(last, EXIT, FALLTHROUGH);
+
+    // goto => label
+    for (std::vector<std::pair<unsigned int, std::string> >::const_iterator it = mGotos.begin(); it != mGotos.end(); ++it) {
+        const std::map<std::string, unsigned int>::const_iterator label = mLabels.find(it->second);
+        addEdge(it->first, label != mLabels.end() ? label->second : (unsigned int)EXIT, JUMP);
+    }
+
+    computeReachable();
+}
+
+unsigned int ControlFlowGraph::newBlock()
+{
+    const unsigned int index = static_cast<unsigned int>(mBlocks.size());
+    mBlocks.push_back(BasicBlock(index));
+    if (!mTryBlocks.empty())
+        mTryBlocks.back().push_back(index);
+    return index;
+}
+
+void ControlFlowGraph::addEdge(unsigned int from, unsigned int to, EdgeType type)
+{
+    for (std::vector<Edge>::const_iterator it = mBlocks[from].successors.begin(); it != mBlocks[from].successors.end(); ++it) {
+        if (it->block == to && it->type == type)
+            return;
+    }
+    mBlocks[from].successors.push_back(Edge(to, type));
+    mBlocks[to].predecessors.push_back(Edge(from, type));
+}
+
+void ControlFlowGraph::addStatement(unsigned int block, const Token *start, const Token *end)
+{
+    if (start == end)
+        return;
+    mBlocks[block].statements.push_back(Statement(start, end));
+    mStatementBlock[start] = block;
+}
+
+void ControlFlowGraph::addExceptionEdges(unsigned int block)
+{
+    if (mCatchBlocks.empty()) {
+        addEdge(block, EXIT, EXCEPTION);
+        return;
+    }
+    const std::vector<unsigned int> &catchBlocks = mCatchBlocks.back();
+    for (std::vector<unsigned int>::const_iterator it = catchBlocks.begin(); it != catchBlocks.end(); ++it)
+        addEdge(block, *it, EXCEPTION);
+}
+
+unsigned int ControlFlowGraph::build(const Token *start, const Token *end, unsigned int current)
+{
+    const Token *tok = start;
+    while (tok && tok != end)
+        current = buildStatement(&tok, current);
+    return current;
+}
+
+unsigned int ControlFlowGraph::buildStatement(const Token **tokptr, unsigned int current)
+{
+    const Token * const tok = *tokptr;
+
+    if (tok->str() == ";") {
+        *tokptr = tok->next();
+        return current;
+    }
+
+    // plain block
+    if (tok->str() == "{") {
+        *tokptr = tok->link()->next();
+        return build(tok->next(), tok->link(), current);
+    }
+
+    if (Token::simpleMatch(tok, "if (") && Token::simpleMatch(tok->linkAt(1), ") {")) {
+        const Token *condition = tok->next()->astOperand2();
+        const Token *thenStart = tok->linkAt(1)->next();
+        addStatement(current, tok->tokAt(2), tok->linkAt(1));
+        mBlocks[current].condition = condition;
+
+        const unsigned int thenBlock = newBlock();
+        if (!isKnownFalse(condition))
+            addEdge(current, thenBlock, TRUE_BRANCH);
+        const unsigned int thenEnd = build(thenStart->next(), thenStart->link(), thenBlock);
+
+        unsigned int elseEnd = current;
+        *tokptr = thenStart->link()->next();
+        if (Token::simpleMatch(thenStart->link(), "} else {")) {
+            const Token *elseStart = thenStart->link()->tokAt(2);
+            const unsigned int elseBlock = newBlock();
+            if (!isKnownTrue(condition))
+                addEdge(current, elseBlock, FALSE_BRANCH);
+            elseEnd = build(elseStart->next(), elseStart->link(), elseBlock);
+            *tokptr = elseStart->link()->next();
+        }
+
+        const unsigned int after = newBlock();
+        addEdge(thenEnd, after, FALLTHROUGH);
+        if (elseEnd != current)
+            addEdge(elseEnd, after, FALLTHROUGH);
+        else if (!isKnownTrue(condition))
+            addEdge(current, after, FALSE_BRANCH);
+        return after;
+    }
+
+    if (Token::simpleMatch(tok, "while (") && Token::simpleMatch(tok->linkAt(1), ") {")) {
+        const Token *condition = tok->next()->astOperand2();
+        const Token *bodyStart = tok->linkAt(1)->next();
+
+        const unsigned int conditionBlock = newBlock();
+        addEdge(current, conditionBlock, FALLTHROUGH);
+        addStatement(conditionBlock, tok->tokAt(2), tok->linkAt(1));
+        mBlocks[conditionBlock].condition = condition;
+
+        const unsigned int body = newBlock();
+        const unsigned int after = newBlock();
+        if (!isKnownFalse(condition))
+            addEdge(conditionBlock, body, TRUE_BRANCH);
+        if (!isKnownTrue(condition))
+            addEdge(conditionBlock, after, FALSE_BRANCH);
+
+        mLoops.push_back(Loop(after, conditionBlock));
+        const unsigned int bodyEnd = build(bodyStart->next(), bodyStart->link(), body);
+        mLoops.pop_back();
+        addEdge(bodyEnd, conditionBlock, FALLTHROUGH);
+
+        *tokptr = bodyStart->link()->next();
+        return after;
+    }
+
+    if (Token::simpleMatch(tok, "do {") && Token::simpleMatch(tok->linkAt(1), "} while (")) {
+        const Token *bodyStart = tok->next();
+        const Token *whileTok = bodyStart->link()->next();
+        const Token *condition = whileTok->next()->astOperand2();
+
+        const unsigned int body = newBlock();
+        addEdge(current, body, FALLTHROUGH);
+        const unsigned int conditionBlock = newBlock();
+        const unsigned int after = newBlock();
+
+        mLoops.push_back(Loop(after, conditionBlock));
+        const unsigned int bodyEnd = build(bodyStart->next(), bodyStart->link(), body);
+        mLoops.pop_back();
+        addEdge(bodyEnd, conditionBlock, FALLTHROUGH);
+
+        addStatement(conditionBlock, whileTok->tokAt(2), whileTok->linkAt(1));
+        mBlocks[conditionBlock].condition = condition;
+        if (!isKnownFalse(condition))
+            addEdge(conditionBlock, body, TRUE_BRANCH);
+        if (!isKnownTrue(condition))
+            addEdge(conditionBlock, after, FALSE_BRANCH);
+
+        *tokptr = whileTok->linkAt(1)->next();
+        if (Token::simpleMatch(*tokptr, ";"))
+            *tokptr = (*tokptr)->next();
+        return after;
+    }
+
+    if (Token::simpleMatch(tok, "for (") && Token::simpleMatch(tok->linkAt(1), ") {")) {
+        const Token *bodyStart = tok->linkAt(1)->next();
+        const Token *header = tok->next()->astOperand2();
+
+        const unsigned int conditionBlock = newBlock();
+        const unsigned int body = newBlock();
+        const unsigned int increment = newBlock();
+        const unsigned int after = newBlock();
+
+        const Token *semicolon1 = Token::findsimplematch(tok->tokAt(2), ";", tok->linkAt(1));
+        const Token *semicolon2 = semicolon1 ? Token::findsimplematch(semicolon1->next(), ";", tok->linkAt(1)) : nullptr;
+        if (semicolon2) {
+            // for (init; condition; increment)
+            const Token *condition = (header && header->astOperand2()) ? header->astOperand2()->astOperand1() : nullptr;
+            addStatement(current, tok->tokAt(2), semicolon1);
+            addEdge(current, conditionBlock, FALLTHROUGH);
+            addStatement(conditionBlock, semicolon1->next(), semicolon2);
+            mBlocks[conditionBlock].condition = condition;
+            addEdge(conditionBlock, body, TRUE_BRANCH);
+            if (condition && !isKnownTrue(condition))
+                addEdge(conditionBlock, after, FALSE_BRANCH);
+            addStatement(increment, semicolon2->next(), tok->linkAt(1));
+        } else {
+            // range for loop
+            addEdge(current, conditionBlock, FALLTHROUGH);
+            addStatement(conditionBlock, tok->tokAt(2), tok->linkAt(1));
+            mBlocks[conditionBlock].condition = header;
+            addEdge(conditionBlock, body, TRUE_BRANCH);
+            addEdge(conditionBlock, after, FALSE_BRANCH);
+        }
+        addEdge(increment, conditionBlock, FALLTHROUGH);
+
+        mLoops.push_back(Loop(after, increment));
+        const unsigned int bodyEnd = build(bodyStart->next(), bodyStart->link(), body);
+        mLoops.pop_back();
+        addEdge(bodyEnd, increment, FALLTHROUGH);
+
+        *tokptr = bodyStart->link()->next();
+        return after;
+    }
+
+    if (Token::simpleMatch(tok, "switch (") && Token::simpleMatch(tok->linkAt(1), ") {")) {
+        const Token *bodyStart = tok->linkAt(1)->next();
+        addStatement(current, tok->tokAt(2), tok->linkAt(1));
+        mBlocks[current].condition = tok->next()->astOperand2();
+
+        const unsigned int after = newBlock();
+        mLoops.push_back(Loop(after, mLoops.empty() ? (unsigned int)EXIT : mLoops.back().continueTarget));
+        mSwitches.push_back(std::make_pair(current, false));
+        // the code before the first case label is not reachable
+        const unsigned int bodyEnd = build(bodyStart->next(), bodyStart->link(), newBlock());
+        addEdge(bodyEnd, after, FALLTHROUGH);
+        if (!mSwitches.back().second)
+            addEdge(current, after, FALSE_BRANCH);
+        mSwitches.pop_back();
+        mLoops.pop_back();
+
+        *tokptr = bodyStart->link()->next();
+        return after;
+    }
+
+    if (Token::Match(tok, "case|default") && !mSwitches.empty()) {
+        const Token *colon = tok;
+        while (colon && colon->str() != ":")
+            colon = colon->next();
+        if (!colon)
+            colon = tok;
+        const unsigned int label = newBlock();
+        addEdge(current, label, FALLTHROUGH);
+        addEdge(mSwitches.back().first, label, JUMP);
+        if (tok->str() == "default")
+            mSwitches.back().second = true;
+        *tokptr = colon->next();
+        return label;
+    }
+
+    if (Token::simpleMatch(tok, "try {")) {
+        const Token *bodyStart = tok->next();
+
+        std::vector<unsigned int> catchBlocks;
+        for (const Token *catchTok = bodyStart->link()->next(); Token::simpleMatch(catchTok, "catch (") && Token::simpleMatch(catchTok->linkAt(1), ") {"); catchTok = catchTok->linkAt(1)->linkAt(1)->next())
+            catchBlocks.push_back(newBlock());
+
+        mCatchBlocks.push_back(catchBlocks);
+        mTryBlocks.push_back(std::vector<unsigned int>());
+        const unsigned int body = newBlock();
+        addEdge(current, body, FALLTHROUGH);
+        const unsigned int bodyEnd = build(bodyStart->next(), bodyStart->link(), body);
+        // any statement in the try block might throw, blocks of nested try blocks throw to their own handlers
+        const std::vector<unsigned int> tryBlocks(mTryBlocks.back());
+        for (std::vector<unsigned int>::const_iterator it = tryBlocks.begin(); it != tryBlocks.end(); ++it)
+            addExceptionEdges(*it);
+        mTryBlocks.pop_back();
+        mCatchBlocks.pop_back();
+
+        const unsigned int after = newBlock();
+        addEdge(bodyEnd, after, FALLTHROUGH);
+
+        const Token *catchTok = bodyStart->link()->next();
+        for (std::vector<unsigned int>::const_iterator it = catchBlocks.begin(); it != catchBlocks.end(); ++it) {
+            const Token *catchStart = catchTok->linkAt(1)->next();
+            addStatement(*it, catchTok->tokAt(2), catchTok->linkAt(1));
+            const unsigned int catchEnd = build(catchStart->next(), catchStart->link(), *it);
+            addEdge(catchEnd, after, FALLTHROUGH);
+            catchTok = catchStart->link()->next();
+        }
+
+        *tokptr = catchTok;
+        return after;
+    }
+
+    // label
+    if (Token::Match(tok, "%name% :") && !Token::Match(tok, "case|default") && Token::Match(tok->previous(), "[;{}:]")) {
+        const unsigned int label = newBlock();
+        addEdge(current, label, FALLTHROUGH);
+        mLabels[tok->str()] = label;
+        *tokptr = tok->tokAt(2);
+        return label;
+    }
+
+    const Token *end = findStatementEnd(tok);
+    if (!end) {
+        *tokptr = nullptr;
+        return current;
+    }
+    *tokptr = (end->str() == ";") ? end->next() : end;
+    addStatement(current, tok, end);
+
+    if (Token::Match(tok, "return|throw")) {
+        if (tok->str() == "return")
+            addEdge(current, EXIT, JUMP);
+        else
+            addExceptionEdges(current);
+        return newBlock();
+    }
+
+    if (Token::Match(tok, "break|continue ;")) {
+        if (!mLoops.empty())
+            addEdge(current, tok->str() == "break" ? mLoops.back().breakTarget : mLoops.back().continueTarget, JUMP);
+        return newBlock();
+    }
+
+    if (Token::Match(tok, "goto %name% ;")) {
+        mGotos.push_back(std::make_pair(current, tok->next()->str()));
+        return newBlock();
+    }
+
+    // call of noreturn function
+    for (const Token *tok2 = tok; tok2 != end; tok2 = tok2->next()) {
+        if (tok2->str() == "{") {
+            // lambda, initializer list
+            tok2 = tok2->link();
+        } else if (Token::Match(tok2, "%name% (") && !tok2->isKeyword() && mLibrary->isnoreturn(tok2)) {
+            addEdge(current, EXIT, NORETURN);
+            return newBlock();
+        }
+    }
+
+    return current;
+}
+
+void ControlFlowGraph::computeReachable()
+{
+    mReachable.assign(mBlocks.size(), false);
+    std::vector<unsigned int> worklist(1U, (unsigned int)ENTRY);
+    mReachable[ENTRY] = true;
+    while (!worklist.empty()) {
+        const unsigned int block = worklist.back();
+        worklist.pop_back();
+        for (std::vector<Edge>::const_iterator it = mBlocks[block].successors.begin(); it != mBlocks[block].successors.end(); ++it) {
+            if (!mReachable[it->block]) {
+                mReachable[it->block] = true;
+                worklist.push_back(it->block);
+            }
+        }
+    }
+}
+
+const ControlFlowGraph::BasicBlock *ControlFlowGraph::findBlock(const Token *statementStart) const
+{
+    const std::map<const Token *, unsigned int>::const_iterator it = mStatementBlock.find(statementStart);
+    return (it != mStatementBlock.end()) ? &mBlocks[it->second] : nullptr;
+}
+
+std::string ControlFlowGraph::str() const
+{
+    static const char * const edgeNames[] = { "", "true", "false", "jump", "exception", "noreturn" };
+
+    std::ostringstream ret;
+    for (std::vector<BasicBlock>::const_iterator block = mBlocks.begin(); block != mBlocks.end(); ++block) {
+        if (block->index > EXIT && !isReachable(block->index) && block->statements.empty())
+            continue;
+        ret << block->index << ":";
+        for (std::vector<Statement>::const_iterator stmt = block->statements.begin(); stmt != block->statements.end(); ++stmt)
+            ret << " [" << stmt->start->stringifyList(stmt->end, false) << "]";
+        if (!block->successors.empty())
+            ret << " ->";
+        for (std::vector<Edge>::const_iterator edge = block->successors.begin(); edge != block->successors.end(); ++edge) {
+            ret << " " << edge->block;
+            if (edge->type != FALLTHROUGH)
+                ret << "(" << edgeNames[edge->type] << ")";
+        }
+        ret << "\n";
+    }
+    return ret.str();
+}
@@ -0,0 +1,166 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef controlflowH
+#define controlflowH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Library;
+class Scope;
+class Token;
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Control flow graph of a function body.
+ *
+ * The graph is built once per function scope when a check asks the symbol
+ * database for it, so checks that need to know how execution can continue
+ * don't have to special case if/else/switch/loops/return/goto
+ * themselves.
+ *
+ * Block 0 is the entry block and block 1 is the exit block. All other
+ * blocks contain a sequence of statements that are executed one after
+ * another. A block that ends with a branch has a condition.
+ */
+class CPPCHECKLIB ControlFlowGraph {
+public:
+    enum EdgeType {
+        FALLTHROUGH,   ///< execution continues in the next block
+        TRUE_BRANCH,   ///< condition is true
+        FALSE_BRANCH,  ///< condition is false
+        JUMP,          ///< return/break/continue/goto/case label
+        EXCEPTION,     ///< exception is thrown
+        NORETURN       ///< call of a noreturn function
+    };
+
+    struct Edge {
+        Edge(unsigned int block_, EdgeType type_) : block(block_), type(type_) {}
+        unsigned int block;
+        EdgeType type;
+    };
+
+    /** @brief A statement "start .. end". The end token is ";" or the ")" of a condition. */
+    struct Statement {
+        Statement(const Token *start_, const Token *end_) : start(start_), end(end_) {}
+        const Token *start;
+        const Token *end;
+    };
+
+    class CPPCHECKLIB BasicBlock {
+    public:
+        explicit BasicBlock(unsigned int index_) : index(index_), condition(nullptr) {}
+
+        unsigned int index;
+
+        /** statements in execution order */
+        std::vector<Statement> statements;
+
+        /** AST of branch condition, the last statement is the condition */
+        const Token *condition;
+
+        std::vector<Edge> successors;
+        std::vector<Edge> predecessors;
+    };
+
+    ControlFlowGraph(const Scope *functionScope, const Library *library);
+
+    const Scope *scope() const {
+        return mScope;
+    }
+
+    const std::vector<BasicBlock> &blocks() const {
+        return mBlocks;
+    }
+
+    const BasicBlock &entry() const {
+        return mBlocks[ENTRY];
+    }
+
+    const BasicBlock &exit() const {
+        return mBlocks[EXIT];
+    }
+
+    /** Get the block that contains the statement with given start token */
+    const BasicBlock *findBlock(const Token *statementStart) const;
+
+    /** Is the block reachable from the entry block? */
+    bool isReachable(unsigned int block) const {
+        return block < mReachable.size() && mReachable[block];
+    }
+
+    /** Text representation of the graph, used in --debug output and in the tests */
+    std::string str() const;
+
+private:
+    enum { ENTRY = 0, EXIT = 1 };
+
+    struct Loop {
+        Loop(unsigned int breakTarget_, unsigned int continueTarget_) : breakTarget(breakTarget_), continueTarget(continueTarget_) {}
+        unsigned int breakTarget;
+        unsigned int continueTarget;
+    };
+
+    unsigned int newBlock();
+    void addEdge(unsigned int from, unsigned int to, EdgeType type);
+    void addStatement(unsigned int block, const Token *start, const Token *end);
+
+    /** Create blocks for the code "start .. end". Returns the block that execution continues in. */
+    unsigned int build(const Token *start, const Token *end, unsigned int current);
+
+    /** Create blocks for a single statement at tok. Returns the block that execution continues in. */
+    unsigned int buildStatement(const Token **tok, unsigned int current);
+
+    /** Add exception edges from the block to the catch blocks or the exit block */
+    void addExceptionEdges(unsigned int block);
+
+    void computeReachable();
+
+    const Scope * const mScope;
+    const Library * const mLibrary;
+    std::vector<BasicBlock> mBlocks;
+    std::vector<bool> mReachable;
+    std::map<const Token *, unsigned int> mStatementBlock;
+
+    /** break/continue targets of the enclosing loops and switches */
+    std::vector<Loop> mLoops;
+
+    /** block with the switch condition and whether a default label was seen */
+    std::vector<std::pair<unsigned int, bool> > mSwitches;
+
+    /** catch blocks of the enclosing try blocks */
+    std::vector<std::vector<unsigned int> > mCatchBlocks;
+
+    /** blocks in the bodies of the enclosing try blocks */
+    std::vector<std::vector<unsigned int> > mTryBlocks;
+    std::map<std::string, unsigned int> mLabels;
+    std::vector<std::pair<unsigned int, std::string> > mGotos;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // controlflowH
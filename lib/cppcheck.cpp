@@ -24,7 +24,9 @@
 #include "path.h"
 #include "platform.h"
 #include "preprocessor.h" // Preprocessor
+#include "summaries.h"
 #include "suppressions.h"
+#include "taskpool.h"
 #include "timer.h"
 #include "token.h"
 #include "tokenize.h" // Tokenizer
@@ -34,10 +36,12 @@
 #include <simplecpp.h>
 #include <tinyxml2.h>
 #include <algorithm>
-#include <cstring>
+#include <exception>
+#include <functional>
 #include <new>
 #include <set>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #ifdef HAVE_RULES
@@ -80,19 +84,23 @@ const char * CppCheck::extraVersion()
 unsigned int CppCheck::check(const std::string &path)
 {
     std::ifstream fin(path);
-    return checkFile(Path::simplifyPath(path), emptyString, fin);
+    return checkFile(Path::simplifyPath(path), emptyString, fin, true);
 }
 
 unsigned int CppCheck::check(const std::string &path, const std::string &content)
 {
     std::istringstream iss(content);
-    return checkFile(Path::simplifyPath(path), emptyString, iss);
+    return checkFile(Path::simplifyPath(path), emptyString, iss, false);
 }
 
 unsigned int CppCheck::check(const ImportProject::FileSettings &fs)
 {
     CppCheck temp(mErrorLogger, mUseGlobalSuppressions);
+    // the summaries are moved to temp and back instead of copying them
+    Summaries summaries;
+    std::swap(mSettings.summaries, summaries);
     temp.mSettings = mSettings;
+    std::swap(temp.mSettings.summaries, summaries);
     if (!temp.mSettings.userDefines.empty())
         temp.mSettings.userDefines += ';';
     temp.mSettings.userDefines += fs.cppcheckDefines();
@@ -102,10 +110,40 @@ unsigned int CppCheck::check(const ImportProject::FileSettings &fs)
         temp.mSettings.platform(fs.platformType);
     }
     std::ifstream fin(fs.filename);
-    return temp.checkFile(Path::simplifyPath(fs.filename), fs.cfg, fin);
+    const unsigned int returnValue = temp.checkFile(Path::simplifyPath(fs.filename), fs.cfg, fin, true);
+    std::swap(mSettings.summaries, temp.mSettings.summaries);
+    return returnValue;
 }
 
-unsigned int CppCheck::checkFile(const std::string& filename, const std::string &cfgname, std::istream& fileStream)
+/** Settings that affect the results of a file, a file in the build dir is analyzed again if they change */
+static std::string getToolInfo(const Settings &settings)
+{
+    std::ostringstream ostr;
+    ostr << CPPCHECK_VERSION_STRING;
+    ostr << (settings.isEnabled(Settings::WARNING) ? 'w' : ' ');
+    ostr << (settings.isEnabled(Settings::STYLE) ? 's' : ' ');
+    ostr << (settings.isEnabled(Settings::PERFORMANCE) ? 'p' : ' ');
+    ostr << (settings.isEnabled(Settings::PORTABILITY) ? 'p' : ' ');
+    ostr << (settings.isEnabled(Settings::INFORMATION) ? 'i' : ' ');
+    ostr << (settings.inconclusive ? 'c' : ' ');
+    ostr << (settings.force ? 'f' : ' ');
+    ostr << settings.maxConfigs << ' ' << settings.valueFlowMaxValues << ' ' << settings.valueFlowMaxFunctionValues << '\n';
+    ostr << "std=" << static_cast<int>(settings.standards.c) << ',' << static_cast<int>(settings.standards.cpp) << (settings.standards.posix ? ",posix" : "") << '\n';
+    ostr << settings.userDefines << '\n';
+    for (const std::string &undef : settings.userUndefs)
+        ostr << "-U" << undef << '\n';
+    for (const std::string &includePath : settings.includePaths)
+        ostr << "-I" << includePath << '\n';
+    ostr << settings.platformString() << '\n';
+    // the hash covers the contents of the .cfg files
+    ostr << "library=" << settings.library.getCacheKey() << '\n';
+    for (const std::string &library : settings.library.getFiles())
+        ostr << library << '\n';
+    settings.nomsg.dump(ostr);
+    return ostr.str();
+}
+
+unsigned int CppCheck::checkFile(const std::string& filename, const std::string &cfgname, std::istream& fileStream, bool fileOnDisk)
 {
     mExitCode = 0;
 
@@ -136,6 +174,20 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
         plistFile.close();
     }
 
+    const std::string toolInfo = mSettings.buildDir.empty() ? emptyString : getToolInfo(mSettings);
+
+    // Skip unchanged files before the includes are loaded
+    if (fileOnDisk && !mSettings.buildDir.empty()) {
+        std::list<ErrorLogger::ErrorMessage> errors;
+        if (AnalyzerInformation::isUnchanged(mSettings.buildDir, filename, cfgname, toolInfo, mSettings.summaries, &errors)) {
+            while (!errors.empty()) {
+                reportErr(errors.front());
+                errors.pop_front();
+            }
+            return mExitCode;
+        }
+    }
+
     CheckUnusedFunctions checkUnusedFunctions(nullptr, nullptr, nullptr);
 
     bool internalErrorFound(false);
@@ -232,27 +284,18 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
         preprocessor.removeComments();
 
         if (!mSettings.buildDir.empty()) {
-            // Get toolinfo
-            std::ostringstream toolinfo;
-            toolinfo << CPPCHECK_VERSION_STRING;
-            toolinfo << (mSettings.isEnabled(Settings::WARNING) ? 'w' : ' ');
-            toolinfo << (mSettings.isEnabled(Settings::STYLE) ? 's' : ' ');
-            toolinfo << (mSettings.isEnabled(Settings::PERFORMANCE) ? 'p' : ' ');
-            toolinfo << (mSettings.isEnabled(Settings::PORTABILITY) ? 'p' : ' ');
-            toolinfo << (mSettings.isEnabled(Settings::INFORMATION) ? 'i' : ' ');
-            toolinfo << mSettings.userDefines;
-            mSettings.nomsg.dump(toolinfo);
-
             // Calculate checksum so it can be compared with old checksum / future checksums
-            const unsigned int checksum = preprocessor.calculateChecksum(tokens1, toolinfo.str());
+            const unsigned int checksum = preprocessor.calculateChecksum(tokens1, toolInfo);
             std::list<ErrorLogger::ErrorMessage> errors;
-            if (!mAnalyzerInformation.analyzeFile(mSettings.buildDir, filename, cfgname, checksum, &errors)) {
+            if (!mAnalyzerInformation.analyzeFile(mSettings.buildDir, filename, cfgname, checksum, mSettings.summaries, &errors)) {
                 while (!errors.empty()) {
                     reportErr(errors.front());
                     errors.pop_front();
                 }
                 return mExitCode;  // known results => no need to reanalyze file
             }
+            if (fileOnDisk)
+                mAnalyzerInformation.setDependencies(toolInfo, files);
         }
 
         // Get directives
@@ -302,7 +345,11 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
             }
         }
 
+        selectAnalyses();
+
         std::set<unsigned long long> checksums;
+        std::string summaries;
+        std::set<std::string> calledFunctions;
         unsigned int checkCount = 0;
         bool hasValidConfig = false;
         std::list<std::string> configurationError;
@@ -356,6 +403,10 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
                 const simplecpp::TokenList &tokensP = preprocessor.preprocess(tokens1, mCurrentConfig, files, true);
                 mTokenizer.createTokens(&tokensP);
                 timer.Stop();
+
+                // Read the library functions that may be called, see Library::loadBinary()
+                mTokenizer.list.summarizeNames();
+                mSettings.library.loadFunctions(mTokenizer.list);
                 hasValidConfig = true;
 
                 // If only errors are printed, print filename after the check
@@ -405,11 +456,16 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
                 checkNormalTokens(mTokenizer);
 
                 // Analyze info..
-                if (!mSettings.buildDir.empty())
+                if (!mSettings.buildDir.empty()) {
                     checkUnusedFunctions.parseTokens(mTokenizer, filename.c_str(), &mSettings);
+                    summaries += Summaries::create(&mTokenizer, &mSettings);
+                    const std::set<std::string> functionNames = Summaries::getCalledFunctions(&mTokenizer);
+                    calledFunctions.insert(functionNames.begin(), functionNames.end());
+                }
 
-                // simplify more if required, skip rest of iteration if failed
-                if (mSimplify) {
+                // All checks run on the normal token list. The simplified token
+                // list is only created for "simple" rules and --debug-simplified.
+                if (mSimplify && (hasRule("simple") || mSettings.debugSimplified)) {
                     // if further simplification fails then skip rest of iteration
                     Timer timer3("Tokenizer::simplifyTokenList2", mSettings.showtime, &S_timerResults);
                     result = mTokenizer.simplifyTokenList2();
@@ -417,8 +473,8 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
                     if (!result)
                         continue;
 
-                    // Check simplified tokens
-                    checkSimplifiedTokens(mTokenizer);
+                    if (!mSettings.terminated())
+                        executeRules("simple", mTokenizer);
                 }
 
             } catch (const simplecpp::Output &o) {
@@ -473,6 +529,13 @@ unsigned int CppCheck::checkFile(const std::string& filename, const std::string
             reportErr(errmsg);
         }
 
+        // Save the function summaries so other translation units can use them
+        if (!mSettings.buildDir.empty()) {
+            mAnalyzerInformation.setSummaries(summaries);
+            mSettings.summaries.setSummaries(AnalyzerInformation::getTranslationUnit(filename, cfgname), summaries);
+            mAnalyzerInformation.setUsedSummaries(calledFunctions, mSettings.summaries);
+        }
+
         // dumped all configs, close root </dumps> element now
         if (mSettings.dump && fdump.is_open())
             fdump << "</dumps>" << std::endl;
@@ -541,19 +604,41 @@ void CppCheck::checkRawTokens(const Tokenizer &tokenizer)
 void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
 {
     // call all "runChecks" in all registered Check classes
-    for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
-        if (mSettings.terminated())
+    if (mSettings.threads > 1 && mSettings.showtime == SHOWTIME_NONE) {
+        if (!runChecksConcurrently(tokenizer))
             return;
+    } else {
+        std::vector<Check *> checks;
+        for (Check *check : Check::instances()) {
+            if (!isCheckSkipped(check, tokenizer))
+                checks.push_back(check);
+        }
+        std::vector<ErrorBuffer> errorBuffers(checks.size());
+        const std::vector<TokenVisitor *> visitors = createTokenVisitors(tokenizer, checks, errorBuffers);
+        runTokenVisitors(tokenizer, visitors);
 
-        if (tokenizer.isMaxTime())
-            return;
+        for (std::size_t i = 0; i < checks.size(); ++i) {
+            if (mSettings.terminated())
+                return;
+
+            // The visitors were run already, report the errors in the same order as the other checks
+            if (visitors[i]) {
+                errorBuffers[i].flush(this);
+                continue;
+            }
+
+            if (tokenizer.isMaxTime())
+                return;
 
-        Timer timerRunChecks((*it)->name() + "::runChecks", mSettings.showtime, &S_timerResults);
-        (*it)->runChecks(&tokenizer, &mSettings, this);
+            Timer timerRunChecks(checks[i]->name() + "::runChecks", mSettings.showtime, &S_timerResults);
+            checks[i]->runChecks(&tokenizer, &mSettings, this);
+        }
     }
 
     // Analyse the tokens..
     for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
+        if (mSkippedChecks.find(*it) != mSkippedChecks.end())
+            continue;
         Check::FileInfo *fi = (*it)->getFileInfo(&tokenizer, &mSettings);
         if (fi != nullptr) {
             mFileInfo.push_back(fi);
@@ -564,44 +649,207 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
     executeRules("normal", tokenizer);
 }
 
-//---------------------------------------------------------------------------
-// CppCheck - A function that checks a simplified token list
-//---------------------------------------------------------------------------
+std::vector<TokenVisitor *> CppCheck::createTokenVisitors(const Tokenizer &tokenizer, const std::vector<Check *> &checks, std::vector<ErrorBuffer> &errorBuffers)
+{
+    std::vector<TokenVisitor *> visitors(checks.size(), nullptr);
+    for (std::size_t i = 0; i < checks.size(); ++i)
+        visitors[i] = checks[i]->createTokenVisitor(&tokenizer, &mSettings, &errorBuffers[i]);
+    return visitors;
+}
 
-void CppCheck::checkSimplifiedTokens(const Tokenizer &tokenizer)
+void CppCheck::runTokenVisitors(const Tokenizer &tokenizer, const std::vector<TokenVisitor *> &visitors)
 {
-    // call all "runSimplifiedChecks" in all registered Check classes
-    for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
-        if (mSettings.terminated())
-            return;
+    std::vector<TokenVisitor *> created;
+    for (TokenVisitor *visitor : visitors) {
+        if (visitor)
+            created.push_back(visitor);
+    }
+    if (created.empty())
+        return;
 
-        if (tokenizer.isMaxTime())
+    try {
+        Timer timer("TokenVisitor::walk", mSettings.showtime, &S_timerResults);
+        TokenVisitor::walk(&tokenizer, created);
+    } catch (...) {
+        for (TokenVisitor *visitor : created)
+            delete visitor;
+        throw;
+    }
+    for (TokenVisitor *visitor : created)
+        delete visitor;
+}
+
+bool CppCheck::runChecksConcurrently(const Tokenizer &tokenizer)
+{
+    std::vector<Check *> checks;
+    for (Check *check : Check::instances()) {
+        if (!isCheckSkipped(check, tokenizer))
+            checks.push_back(check);
+    }
+    std::vector<ErrorBuffer> errorBuffers(checks.size());
+    std::vector<std::exception_ptr> exceptions(checks.size());
+    std::vector<char> done(checks.size(), 0);
+
+    // The checks that are token visitors are run together in one task
+    const std::vector<TokenVisitor *> visitors = createTokenVisitors(tokenizer, checks, errorBuffers);
+    std::exception_ptr visitorException;
+    bool visitorsDone = false;
+    const auto runVisitors = [&]() {
+        try {
+            runTokenVisitors(tokenizer, visitors);
+            visitorsDone = true;
+        } catch (...) {
+            visitorException = std::current_exception();
+        }
+    };
+
+    const auto runCheck = [&](std::size_t i) {
+        if (mSettings.terminated() || tokenizer.isMaxTime())
             return;
+        try {
+            checks[i]->runChecks(&tokenizer, &mSettings, &errorBuffers[i]);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+        done[i] = 1;
+    };
+
+    bool visitorsThreadSafe = true;
+    for (std::size_t i = 0; i < checks.size(); ++i) {
+        if (visitors[i] && !checks[i]->isThreadSafe())
+            visitorsThreadSafe = false;
+    }
 
-        Timer timerSimpleChecks((*it)->name() + "::runSimplifiedChecks", mSettings.showtime, &S_timerResults);
-        (*it)->runSimplifiedChecks(&tokenizer, &mSettings, this);
-        timerSimpleChecks.Stop();
+    std::vector<TaskPool::Task> tasks;
+    if (visitorsThreadSafe)
+        tasks.push_back(runVisitors);
+    for (std::size_t i = 0; i < checks.size(); ++i) {
+        if (!visitors[i] && checks[i]->isThreadSafe())
+            tasks.push_back(std::bind(runCheck, i));
     }
+    TaskPool::run(mSettings.threads, tasks);
 
-    if (!mSettings.terminated())
-        executeRules("simple", tokenizer);
+    if (!visitorsThreadSafe)
+        runVisitors();
+
+    for (std::size_t i = 0; i < checks.size(); ++i) {
+        if (visitors[i])
+            continue;
+        if (!checks[i]->isThreadSafe())
+            runCheck(i);
+        if (exceptions[i])
+            break;
+    }
+
+    // Report the errors in the same order as when the checks are run one by one
+    for (std::size_t i = 0; i < checks.size(); ++i) {
+        if (visitors[i]) {
+            if (visitorException)
+                std::rethrow_exception(visitorException);
+            if (!visitorsDone)
+                return false;
+        } else if (!done[i]) {
+            return false;
+        }
+        errorBuffers[i].flush(this);
+        if (exceptions[i])
+            std::rethrow_exception(exceptions[i]);
+    }
+    return true;
 }
 
-void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &tokenizer)
+namespace {
+    /** Finds out if any of the messages that a check can report is shown */
+    class ErrorIdCollector : public ErrorLogger {
+    public:
+        explicit ErrorIdCollector(const Settings &settings) : listed(false), shown(false), mSettings(settings) {
+        }
+        void reportOut(const std::string & /*outmsg*/) override {
+        }
+        void reportErr(const ErrorLogger::ErrorMessage &msg) override {
+            listed = true;
+            // unusedFunction is enabled separately from the other style messages
+            const bool enabled = (msg._id == "unusedFunction") ? mSettings.isEnabled(Settings::UNUSED_FUNCTION) : mSettings.isEnabled(msg._severity);
+            if (enabled && !mSettings.nomsg.isSuppressedEverywhere(msg._id))
+                shown = true;
+        }
+        bool listed;
+        bool shown;
+    private:
+        const Settings &mSettings;
+    };
+}
+
+void CppCheck::selectAnalyses()
 {
-    (void)tokenlist;
-    (void)tokenizer;
+    mSkippedChecks.clear();
+    mSettings.valueFlowAnalyses = ~0U;
+
+    mTriggerNames.clear();
+    for (const Check *check : Check::instances()) {
+        std::vector<std::string> names = check->triggerNames(&mSettings);
+        if (names.empty())
+            continue;
+        // Only the last part of qualified names is a token
+        for (std::string &name : names) {
+            const std::string::size_type pos = name.rfind("::");
+            if (pos != std::string::npos)
+                name.erase(0, pos + 2);
+        }
+        mTriggerNames[check].swap(names);
+    }
+
+    // Unmatched suppressions, --dump and the debug output need everything
+    if (mSettings.isEnabled(Settings::INFORMATION) || mSettings.checkConfiguration || mSettings.dump || mSettings.debugnormal || mSettings.debugwarnings)
+        return;
+
+    unsigned int valueFlowAnalyses = 0;
+    for (const Check *check : Check::instances()) {
+        ErrorIdCollector errorIds(mSettings);
+        check->getErrorMessages(&errorIds, &mSettings);
+        if (errorIds.listed && !errorIds.shown)
+            mSkippedChecks.insert(check);
+        else
+            valueFlowAnalyses |= check->valueFlowAnalyses();
+    }
+    mSettings.valueFlowAnalyses = valueFlowAnalyses;
+}
+
+bool CppCheck::isCheckSkipped(const Check *check, const Tokenizer &tokenizer) const
+{
+    if (mSkippedChecks.find(check) != mSkippedChecks.end())
+        return true;
+    const std::map<const Check *, std::vector<std::string> >::const_iterator it = mTriggerNames.find(check);
+    if (it == mTriggerNames.end())
+        return false;
+    for (const std::string &name : it->second) {
+        if (tokenizer.list.mayContainName(name))
+            return false;
+    }
+    return true;
+}
 
+bool CppCheck::hasRule(const std::string &tokenlist) const
+{
 #ifdef HAVE_RULES
-    // Are there rules to execute?
-    bool isrule = false;
     for (std::list<Settings::Rule>::const_iterator it = mSettings.rules.begin(); it != mSettings.rules.end(); ++it) {
         if (it->tokenlist == tokenlist)
-            isrule = true;
+            return true;
     }
+#else
+    (void)tokenlist;
+#endif
+    return false;
+}
 
+void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &tokenizer)
+{
+    (void)tokenlist;
+    (void)tokenizer;
+
+#ifdef HAVE_RULES
     // There is no rule to execute
-    if (isrule == false)
+    if (!hasRule(tokenlist))
         return;
 
     // Write all tokens in a string that can be parsed by pcre
@@ -844,38 +1092,18 @@ void CppCheck::analyseWholeProgram(const std::string &buildDir, const std::map<s
     std::list<Check::FileInfo*> fileInfoList;
 
     // Load all analyzer info data..
-    const std::string filesTxt(buildDir + "/files.txt");
-    std::ifstream fin(filesTxt);
-    std::string filesTxtLine;
-    while (std::getline(fin, filesTxtLine)) {
-        const std::string::size_type firstColon = filesTxtLine.find(':');
-        if (firstColon == std::string::npos)
-            continue;
-        const std::string::size_type lastColon = filesTxtLine.rfind(':');
-        if (firstColon == lastColon)
-            continue;
-        const std::string xmlfile = buildDir + '/' + filesTxtLine.substr(0,firstColon);
-        //const std::string sourcefile = filesTxtLine.substr(lastColon+1);
-
-        tinyxml2::XMLDocument doc;
-        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
-        if (error != tinyxml2::XML_SUCCESS)
+    std::list<AnalyzerInformation::FileInfo> fileInfo;
+    AnalyzerInformation::getFileInfo(buildDir, &fileInfo);
+    for (const AnalyzerInformation::FileInfo &checkInfo : fileInfo) {
+        if (checkInfo.check == "CheckUnusedFunctions")
             continue;
-
-        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
-        if (rootNode == nullptr)
-            continue;
-
-        for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-            if (std::strcmp(e->Name(), "FileInfo") != 0)
+        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
+            if (checkInfo.check != (*it)->name())
                 continue;
-            const char *checkClassAttr = e->Attribute("check");
-            if (!checkClassAttr)
-                continue;
-            for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
-                if (checkClassAttr == (*it)->name())
-                    fileInfoList.push_back((*it)->loadFileInfoFromXml(e));
-            }
+            // the data of the checks is xml
+            tinyxml2::XMLDocument doc;
+            if (doc.Parse(("<FileInfo>" + checkInfo.data + "</FileInfo>").c_str()) == tinyxml2::XML_SUCCESS)
+                fileInfoList.push_back((*it)->loadFileInfoFromXml(doc.FirstChildElement()));
         }
     }
 
@@ -32,7 +32,9 @@
 #include <istream>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 class Tokenizer;
 
@@ -46,6 +48,7 @@ class Tokenizer;
  * Usage: See check() for more info.
  */
 class CPPCHECKLIB CppCheck : ErrorLogger {
+    friend class TestCppcheck;
 public:
     /**
      * @brief Constructor.
@@ -153,9 +156,10 @@ private:
      * @param filename file name
      * @param cfgname  cfg name
      * @param fileStream stream the file content can be read from
+     * @param fileOnDisk the stream reads the file, so the build dir can tell if it changed
      * @return number of errors found
      */
-    unsigned int checkFile(const std::string& filename, const std::string &cfgname, std::istream& fileStream);
+    unsigned int checkFile(const std::string& filename, const std::string &cfgname, std::istream& fileStream, bool fileOnDisk);
 
     /**
      * @brief Check raw tokens
@@ -170,10 +174,43 @@ private:
     void checkNormalTokens(const Tokenizer &tokenizer);
 
     /**
-     * @brief Check simplified tokens
+     * @brief Run the checks on a thread pool (--threads). The errors are
+     * reported in the same order as when the checks are run one by one.
      * @param tokenizer tokenizer instance
+     * @return false if the checking was interrupted
      */
-    void checkSimplifiedTokens(const Tokenizer &tokenizer);
+    bool runChecksConcurrently(const Tokenizer &tokenizer);
+
+    /**
+     * @brief Create the token visitors of the checks. The visitors report
+     * the errors to the error buffers of the checks.
+     * @return the visitors, nullptr for checks that are not token visitors
+     */
+    std::vector<TokenVisitor *> createTokenVisitors(const Tokenizer &tokenizer, const std::vector<Check *> &checks, std::vector<ErrorBuffer> &errorBuffers);
+
+    /** @brief Run the token visitors in one walk of the function bodies and delete them */
+    void runTokenVisitors(const Tokenizer &tokenizer, const std::vector<TokenVisitor *> &visitors);
+
+    /**
+     * @brief Skip the checks that can only report messages that are suppressed
+     * or whose severity is not enabled, and the ValueFlow analyses that only
+     * skipped checks use. Also collects the trigger names of the checks.
+     * The messages of a check are those of its getErrorMessages(). A check
+     * that reports an error must list an error there.
+     */
+    void selectAnalyses();
+
+    /**
+     * @brief Is the check skipped for this token list? Either its messages
+     * are suppressed or none of its trigger names are used in the code.
+     */
+    bool isCheckSkipped(const Check *check, const Tokenizer &tokenizer) const;
+
+    /**
+     * @brief Is there any rule for the given token list?
+     * @param tokenlist token list to use (normal / simple)
+     */
+    bool hasRule(const std::string &tokenlist) const;
 
     /**
      * @brief Execute rules, if any
@@ -226,6 +263,12 @@ private:
     /** File info used for whole program analysis */
     std::list<Check::FileInfo*> mFileInfo;
 
+    /** Checks that are not run, see selectAnalyses() */
+    std::set<const Check *> mSkippedChecks;
+
+    /** Trigger names of the checks, see Check::triggerNames() */
+    std::map<const Check *, std::vector<std::string> > mTriggerNames;
+
     AnalyzerInformation mAnalyzerInformation;
 };
 
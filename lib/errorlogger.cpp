@@ -750,3 +750,14 @@ std::string ErrorLogger::plistData(const ErrorLogger::ErrorMessage &msg)
     return plist.str();
 }
 
+
+void ErrorBuffer::flush(ErrorLogger *errorLogger)
+{
+    for (const Message &msg : mMessages) {
+        if (msg.isOut)
+            errorLogger->reportOut(msg.outmsg);
+        else
+            errorLogger->reportErr(msg.errmsg);
+    }
+    mMessages.clear();
+}
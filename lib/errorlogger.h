@@ -387,6 +387,37 @@ public:
     }
 };
 
+/**
+ * @brief Collects the messages of a task that runs in parallel with other
+ * tasks, so they can be reported afterwards in a deterministic order.
+ */
+class CPPCHECKLIB ErrorBuffer : public ErrorLogger {
+public:
+    ErrorBuffer() { }
+
+    virtual void reportOut(const std::string &outmsg) override {
+        mMessages.emplace_back(outmsg);
+    }
+
+    virtual void reportErr(const ErrorLogger::ErrorMessage &msg) override {
+        mMessages.emplace_back(msg);
+    }
+
+    /** Report the collected messages to the given logger and clear the buffer */
+    void flush(ErrorLogger *errorLogger);
+
+private:
+    struct Message {
+        explicit Message(const std::string &outmsg_) : isOut(true), outmsg(outmsg_) {}
+        explicit Message(const ErrorLogger::ErrorMessage &errmsg_) : isOut(false), errmsg(errmsg_) {}
+        bool isOut;
+        std::string outmsg;
+        ErrorLogger::ErrorMessage errmsg;
+    };
+
+    std::vector<Message> mMessages;
+};
+
 /// @}
 //---------------------------------------------------------------------------
 #endif // errorloggerH
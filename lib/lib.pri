@@ -32,6 +32,8 @@ HEADERS += $${PWD}/check.h \
            $${PWD}/checkunusedfunctions.h \
            $${PWD}/checkunusedvar.h \
            $${PWD}/checkvaarg.h \
+           $${PWD}/chunkedlist.h \
+           $${PWD}/controlflow.h \
            $${PWD}/cppcheck.h \
            $${PWD}/errorlogger.h \
            $${PWD}/importproject.h \
@@ -42,8 +44,10 @@ HEADERS += $${PWD}/check.h \
            $${PWD}/platform.h \
            $${PWD}/preprocessor.h \
            $${PWD}/settings.h \
+           $${PWD}/summaries.h \
            $${PWD}/suppressions.h \
            $${PWD}/symboldatabase.h \
+           $${PWD}/taskpool.h \
            $${PWD}/templatesimplifier.h \
            $${PWD}/timer.h \
            $${PWD}/token.h \
@@ -80,6 +84,7 @@ SOURCES += $${PWD}/analyzerinfo.cpp \
            $${PWD}/checkunusedfunctions.cpp \
            $${PWD}/checkunusedvar.cpp \
            $${PWD}/checkvaarg.cpp \
+           $${PWD}/controlflow.cpp \
            $${PWD}/cppcheck.cpp \
            $${PWD}/errorlogger.cpp \
            $${PWD}/importproject.cpp \
@@ -90,8 +95,10 @@ SOURCES += $${PWD}/analyzerinfo.cpp \
            $${PWD}/platform.cpp \
            $${PWD}/preprocessor.cpp \
            $${PWD}/settings.cpp \
+           $${PWD}/summaries.cpp \
            $${PWD}/suppressions.cpp \
            $${PWD}/symboldatabase.cpp \
+           $${PWD}/taskpool.cpp \
            $${PWD}/templatesimplifier.cpp \
            $${PWD}/timer.cpp \
            $${PWD}/token.cpp \
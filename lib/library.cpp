@@ -26,11 +26,18 @@
 #include "token.h"
 #include "tokenlist.h"
 #include "utils.h"
+#include "version.h"
 
+#include <algorithm>
 #include <cctype>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <list>
+#include <mutex>
+#include <random>
+#include <sstream>
 
 static std::vector<std::string> getnames(const char *names)
 {
@@ -55,8 +62,60 @@ static void gettokenlistfromvalid(const std::string& valid, TokenList& tokenList
     }
 }
 
-Library::Library() : mAllocId(0)
+// Snapshots are only valid for the version and binary format that wrote them.
+// Bump binaryFormat when the snapshot layout changes.
+static const int binaryFormat = 2;
+
+static unsigned long long hashCfg(unsigned long long h, const std::string &data)
 {
+    for (const char c : data) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h ^ data.size();
+}
+
+// FNV-1a offset basis, the version and the binary format, the hash of a library without .cfg files
+static unsigned long long emptyCacheKey()
+{
+    static const unsigned long long key = hashCfg(14695981039346656037ULL, CPPCHECK_VERSION_STRING " " + MathLib::toString(binaryFormat));
+    return key;
+}
+
+Library::Library() : mAllocId(0), mCacheKey(emptyCacheKey())
+{
+}
+
+static bool readFile(const std::string &filename, std::string *data)
+{
+    std::ifstream fin(filename, std::ios::binary);
+    if (!fin.is_open())
+        return false;
+    std::ostringstream ostr;
+    ostr << fin.rdbuf();
+    *data = ostr.str();
+    return true;
+}
+
+static std::string cacheFileName(const std::string &dir, unsigned long long key)
+{
+    std::ostringstream ostr;
+    ostr << dir << "/cfg-" << std::hex << key << ".bin";
+    return ostr.str();
+}
+
+static void writeCacheFile(const std::string &filename, const std::string &data)
+{
+    // Write a temporary file first so parallel cppcheck processes never read a partial snapshot
+    const std::string tempfile = filename + '.' + MathLib::toString(std::random_device()());
+    {
+        std::ofstream fout(tempfile, std::ios::binary);
+        if (!fout.is_open())
+            return;
+        fout << data;
+    }
+    if (std::rename(tempfile.c_str(), filename.c_str()) != 0)
+        std::remove(tempfile.c_str());
 }
 
 Library::Error Library::load(const char exename[], const char path[])
@@ -79,15 +138,15 @@ Library::Error Library::load(const char exename[], const char path[])
 
     std::string absolute_path;
     // open file..
-    tinyxml2::XMLDocument doc;
-    tinyxml2::XMLError error = doc.LoadFile(path);
-    if (error == tinyxml2::XML_ERROR_FILE_NOT_FOUND) {
+    std::string data;
+    bool found = readFile(path, &data);
+    if (!found) {
         // failed to open file.. is there no extension?
         std::string fullfilename(path);
         if (Path::getFilenameExtension(fullfilename).empty()) {
             fullfilename += ".cfg";
-            error = doc.LoadFile(fullfilename.c_str());
-            if (error != tinyxml2::XML_ERROR_FILE_NOT_FOUND)
+            found = readFile(fullfilename, &data);
+            if (found)
                 absolute_path = Path::getAbsoluteFilePath(fullfilename);
         }
 
@@ -101,30 +160,47 @@ Library::Error Library::load(const char exename[], const char path[])
             cfgfolders.push_back(exepath);
         }
 
-        while (error == tinyxml2::XML_ERROR_FILE_NOT_FOUND && !cfgfolders.empty()) {
+        while (!found && !cfgfolders.empty()) {
             const std::string cfgfolder(cfgfolders.front());
             cfgfolders.pop_front();
             const char *sep = (!cfgfolder.empty() && endsWith(cfgfolder,'/') ? "" : "/");
             const std::string filename(cfgfolder + sep + fullfilename);
-            error = doc.LoadFile(filename.c_str());
-            if (error != tinyxml2::XML_ERROR_FILE_NOT_FOUND)
+            found = readFile(filename, &data);
+            if (found)
                 absolute_path = Path::getAbsoluteFilePath(filename);
         }
     } else
         absolute_path = Path::getAbsoluteFilePath(path);
 
-    if (error == tinyxml2::XML_SUCCESS) {
-        if (mFiles.find(absolute_path) == mFiles.end()) {
-            Error err = load(doc);
-            if (err.errorcode == OK)
-                mFiles.insert(absolute_path);
-            return err;
-        }
+    if (!found)
+        return Error(FILE_NOT_FOUND);
 
+    if (mFiles.find(absolute_path) != mFiles.end())
         return Error(OK); // ignore duplicates
+
+    // A snapshot is valid if the same files were loaded in the same order
+    const unsigned long long cacheKey = mCacheKey ? hashCfg(hashCfg(mCacheKey, absolute_path), data) : 0;
+    const std::string cacheFile = (cacheKey && !mCacheDir.empty()) ? cacheFileName(mCacheDir, cacheKey) : emptyString;
+    if (!cacheFile.empty()) {
+        std::string snapshot;
+        if (readFile(cacheFile, &snapshot) && loadBinary(snapshot)) {
+            mCacheKey = cacheKey;
+            return Error(OK);
+        }
     }
 
-    return Error(error == tinyxml2::XML_ERROR_FILE_NOT_FOUND ? FILE_NOT_FOUND : BAD_XML);
+    tinyxml2::XMLDocument doc;
+    if (doc.Parse(data.c_str(), data.size()) != tinyxml2::XML_SUCCESS)
+        return Error(BAD_XML);
+
+    Error err = load(doc);
+    if (err.errorcode == OK) {
+        mFiles.insert(absolute_path);
+        mCacheKey = cacheKey;
+        if (!cacheFile.empty())
+            writeCacheFile(cacheFile, saveBinary());
+    }
+    return err;
 }
 
 bool Library::loadxmldata(const char xmldata[], std::size_t len)
@@ -133,6 +209,467 @@ bool Library::loadxmldata(const char xmldata[], std::size_t len)
     return (tinyxml2::XML_SUCCESS == doc.Parse(xmldata, len)) && (load(doc).errorcode == OK);
 }
 
+namespace {
+    /** Write the binary library snapshot */
+    class BinaryWriter {
+    public:
+        void u8(unsigned int value) {
+            data.push_back(static_cast<char>(value & 0xff));
+        }
+        void i32(int value) {
+            const unsigned int u = static_cast<unsigned int>(value);
+            for (int shift = 0; shift < 32; shift += 8)
+                u8(u >> shift);
+        }
+        void str(const std::string &s) {
+            i32(static_cast<int>(s.size()));
+            data += s;
+        }
+        void strings(const std::set<std::string> &s) {
+            i32(static_cast<int>(s.size()));
+            for (const std::string &str1 : s)
+                str(str1);
+        }
+        template<class M, class F>
+        void map(const M &m, F writeValue) {
+            i32(static_cast<int>(m.size()));
+            for (const auto &it : m) {
+                str(it.first);
+                writeValue(it.second);
+            }
+        }
+        /** hash maps are written in sorted order so the snapshot only depends on the contents */
+        template<class T, class F>
+        void map(const std::unordered_map<std::string, T> &m, F writeValue) {
+            std::vector<const typename std::unordered_map<std::string, T>::value_type *> sorted;
+            sorted.reserve(m.size());
+            for (const auto &it : m)
+                sorted.push_back(&it);
+            std::sort(sorted.begin(), sorted.end(), [](const typename std::unordered_map<std::string, T>::value_type *a,
+                                                       const typename std::unordered_map<std::string, T>::value_type *b) {
+                return a->first < b->first;
+            });
+            i32(static_cast<int>(sorted.size()));
+            for (const auto *it : sorted) {
+                str(it->first);
+                writeValue(it->second);
+            }
+        }
+
+        std::string data;
+    };
+
+    /** Read the binary library snapshot. After an error all reads return 0 and ok() is false. */
+    class BinaryReader {
+    public:
+        BinaryReader(const char *begin, const char *end) : mPos(begin), mEnd(end), mOk(true) {}
+
+        const char *pos() const {
+            return mPos;
+        }
+
+        bool ok() const {
+            return mOk;
+        }
+        bool atEnd() const {
+            return mPos == mEnd;
+        }
+        unsigned int u8() {
+            if (!mOk || mPos == mEnd) {
+                mOk = false;
+                return 0;
+            }
+            return static_cast<unsigned char>(*mPos++);
+        }
+        int i32() {
+            unsigned int u = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+                u |= u8() << shift;
+            return static_cast<int>(u);
+        }
+        /** number of elements that follow, each element is at least one byte */
+        int count() {
+            const int n = i32();
+            if (n < 0 || n > mEnd - mPos)
+                mOk = false;
+            return mOk ? n : 0;
+        }
+        std::string str() {
+            const int n = count();
+            const std::string s(mPos, n);
+            mPos += n;
+            return s;
+        }
+        /** skip a str(), returns its size */
+        int skipStr() {
+            const int n = count();
+            mPos += n;
+            return n;
+        }
+        std::set<std::string> strings() {
+            std::set<std::string> s;
+            for (int n = count(); n > 0; --n)
+                s.insert(str());
+            return s;
+        }
+        template<class M, class F>
+        void map(M *m, F readValue) {
+            for (int n = count(); n > 0; --n) {
+                const std::string key = str();
+                readValue(&(*m)[key]);
+            }
+        }
+
+    private:
+        const char *mPos;
+        const char * const mEnd;
+        bool mOk;
+    };
+}
+
+static void writeArgumentChecks(BinaryWriter &w, const std::map<int, Library::ArgumentChecks> &argumentChecks)
+{
+    w.i32(static_cast<int>(argumentChecks.size()));
+    for (std::map<int, Library::ArgumentChecks>::const_iterator it = argumentChecks.cbegin(); it != argumentChecks.cend(); ++it) {
+        const Library::ArgumentChecks &ac = it->second;
+        w.i32(it->first);
+        w.u8(ac.notbool);
+        w.u8(ac.notnull);
+        w.u8(ac.notuninit);
+        w.u8(ac.formatstr);
+        w.u8(ac.strz);
+        w.u8(ac.optional);
+        w.u8(ac.variadic);
+        w.str(ac.valid);
+        w.i32(ac.iteratorInfo.container);
+        w.u8(ac.iteratorInfo.it);
+        w.u8(ac.iteratorInfo.first);
+        w.u8(ac.iteratorInfo.last);
+        w.i32(static_cast<int>(ac.minsizes.size()));
+        for (const Library::ArgumentChecks::MinSize &minsize : ac.minsizes) {
+            w.u8(minsize.type);
+            w.i32(minsize.arg);
+            w.i32(minsize.arg2);
+        }
+    }
+}
+
+static void readArgumentChecks(BinaryReader &r, std::map<int, Library::ArgumentChecks> *argumentChecks)
+{
+    for (int n = r.count(); n > 0; --n) {
+        Library::ArgumentChecks &ac = (*argumentChecks)[r.i32()];
+        ac.notbool = r.u8() != 0;
+        ac.notnull = r.u8() != 0;
+        ac.notuninit = r.u8() != 0;
+        ac.formatstr = r.u8() != 0;
+        ac.strz = r.u8() != 0;
+        ac.optional = r.u8() != 0;
+        ac.variadic = r.u8() != 0;
+        ac.valid = r.str();
+        ac.iteratorInfo.container = r.i32();
+        ac.iteratorInfo.it = r.u8() != 0;
+        ac.iteratorInfo.first = r.u8() != 0;
+        ac.iteratorInfo.last = r.u8() != 0;
+        for (int m = r.count(); m > 0; --m) {
+            const Library::ArgumentChecks::MinSize::Type type = static_cast<Library::ArgumentChecks::MinSize::Type>(r.u8());
+            const int arg = r.i32();
+            ac.minsizes.emplace_back(type, arg);
+            ac.minsizes.back().arg2 = r.i32();
+        }
+    }
+}
+
+std::string Library::saveBinary() const
+{
+    BinaryWriter w;
+    w.str("cppcheck-cfg");
+    w.i32(binaryFormat);
+    w.str(CPPCHECK_VERSION_STRING);
+
+    w.i32(mAllocId);
+    w.strings(mFiles);
+    const auto writeAllocFunc = [&w](const AllocFunc &af) {
+        w.i32(af.groupId);
+        w.i32(af.arg);
+    };
+    w.map(mAlloc, writeAllocFunc);
+    w.map(mDealloc, writeAllocFunc);
+    const auto writeBool = [&w](bool b) {
+        w.u8(b);
+    };
+    const auto writeInt = [&w](int i) {
+        w.i32(i);
+    };
+    const auto writeString = [&w](const std::string &s) {
+        w.str(s);
+    };
+    const auto writeStrings = [&w](const std::set<std::string> &s) {
+        w.strings(s);
+    };
+    w.map(mNoReturn, writeBool);
+    w.map(mReturnValue, writeString);
+    w.map(mReturnValueType, writeString);
+    w.map(mReturnValueContainer, writeInt);
+    w.map(mReportErrors, writeBool);
+    w.map(mProcessAfterCode, writeBool);
+    w.strings(mMarkupExtensions);
+    w.map(mKeywords, writeStrings);
+    w.map(mExecutableBlocks, [&w](const CodeBlock &block) {
+        w.str(block.start());
+        w.str(block.end());
+        w.i32(block.offset());
+        w.strings(block.blocks());
+    });
+    w.map(mExporters, [&w](const ExportedFunctions &exporter) {
+        w.strings(exporter.prefixes());
+        w.strings(exporter.suffixes());
+    });
+    w.map(mImporters, writeStrings);
+    w.map(mReflection, writeInt);
+    w.map(mPodTypes, [&w](const PodType &podType) {
+        w.i32(static_cast<int>(podType.size));
+        w.u8(static_cast<unsigned char>(podType.sign));
+    });
+    const auto writePlatformType = [&w](const PlatformType &type) {
+        w.str(type.mType);
+        w.u8(type._signed);
+        w.u8(type._unsigned);
+        w.u8(type._long);
+        w.u8(type._pointer);
+        w.u8(type._ptr_ptr);
+        w.u8(type._const_ptr);
+    };
+    w.map(mPlatformTypes, writePlatformType);
+    w.map(mPlatforms, [&w, &writePlatformType](const Platform &platform) {
+        w.map(platform.mPlatformTypes, writePlatformType);
+    });
+
+    w.map(functionwarn, [&w](const WarnInfo &wi) {
+        w.str(wi.message);
+        w.u8(wi.standards.c);
+        w.u8(wi.standards.cpp);
+        w.u8(wi.standards.posix);
+        w.u8(wi.severity);
+    });
+    w.map(containers, [&w](const Container &container) {
+        w.str(container.startPattern);
+        w.str(container.endPattern);
+        w.str(container.itEndPattern);
+        w.map(container.functions, [&w](const Container::Function &f) {
+            w.u8(f.action);
+            w.u8(f.yield);
+        });
+        w.i32(container.type_templateArgNo);
+        w.i32(container.size_templateArgNo);
+        w.u8(container.arrayLike_indexOp);
+        w.u8(container.stdStringLike);
+        w.u8(container.opLessAllowed);
+    });
+    // The argument checks of each function are stored as a string so they can be read lazily
+    w.i32(static_cast<int>(functions.size()));
+    for (std::map<std::string, Function>::const_iterator it = functions.cbegin(); it != functions.cend(); ++it) {
+        const Function &f = it->second;
+        w.str(it->first);
+        const std::unordered_map<std::string, LazyArgumentChecks>::const_iterator lazy = mLazyArgumentChecks.find(it->first);
+        if (lazy != mLazyArgumentChecks.cend()) {
+            w.str(mBinaryData->substr(lazy->second.offset, lazy->second.size));
+        } else {
+            BinaryWriter argumentChecks;
+            writeArgumentChecks(argumentChecks, f.argumentChecks);
+            w.str(argumentChecks.data);
+        }
+        w.u8(f.use);
+        w.u8(f.leakignore);
+        w.u8(f.isconst);
+        w.u8(f.ispure);
+        w.u8(f.useretval);
+        w.u8(f.ignore);
+        w.u8(f.formatstr);
+        w.u8(f.formatstr_scan);
+        w.u8(f.formatstr_secure);
+    }
+    w.strings(returnuninitdata);
+    w.i32(static_cast<int>(defines.size()));
+    for (const std::string &define : defines)
+        w.str(define);
+    return w.data;
+}
+
+bool Library::loadBinary(const std::string &data)
+{
+    BinaryReader r(data.data(), data.data() + data.size());
+    if (r.str() != "cppcheck-cfg" || r.i32() != binaryFormat || r.str() != CPPCHECK_VERSION_STRING)
+        return false;
+
+    Library lib;
+    lib.mAllocId = r.i32();
+    lib.mFiles = r.strings();
+    const auto readAllocFunc = [&r](AllocFunc *af) {
+        af->groupId = r.i32();
+        af->arg = r.i32();
+    };
+    r.map(&lib.mAlloc, readAllocFunc);
+    r.map(&lib.mDealloc, readAllocFunc);
+    const auto readBool = [&r](bool *b) {
+        *b = r.u8() != 0;
+    };
+    const auto readInt = [&r](int *i) {
+        *i = r.i32();
+    };
+    const auto readString = [&r](std::string *s) {
+        *s = r.str();
+    };
+    const auto readStrings = [&r](std::set<std::string> *s) {
+        *s = r.strings();
+    };
+    r.map(&lib.mNoReturn, readBool);
+    r.map(&lib.mReturnValue, readString);
+    r.map(&lib.mReturnValueType, readString);
+    r.map(&lib.mReturnValueContainer, readInt);
+    r.map(&lib.mReportErrors, readBool);
+    r.map(&lib.mProcessAfterCode, readBool);
+    lib.mMarkupExtensions = r.strings();
+    r.map(&lib.mKeywords, readStrings);
+    r.map(&lib.mExecutableBlocks, [&r](CodeBlock *block) {
+        block->setStart(r.str().c_str());
+        block->setEnd(r.str().c_str());
+        block->setOffset(r.i32());
+        for (const std::string &blockName : r.strings())
+            block->addBlock(blockName.c_str());
+    });
+    r.map(&lib.mExporters, [&r](ExportedFunctions *exporter) {
+        for (const std::string &prefix : r.strings())
+            exporter->addPrefix(prefix);
+        for (const std::string &suffix : r.strings())
+            exporter->addSuffix(suffix);
+    });
+    r.map(&lib.mImporters, readStrings);
+    r.map(&lib.mReflection, readInt);
+    r.map(&lib.mPodTypes, [&r](PodType *podType) {
+        podType->size = static_cast<unsigned int>(r.i32());
+        podType->sign = static_cast<char>(r.u8());
+    });
+    const auto readPlatformType = [&r](PlatformType *type) {
+        type->mType = r.str();
+        type->_signed = r.u8() != 0;
+        type->_unsigned = r.u8() != 0;
+        type->_long = r.u8() != 0;
+        type->_pointer = r.u8() != 0;
+        type->_ptr_ptr = r.u8() != 0;
+        type->_const_ptr = r.u8() != 0;
+    };
+    r.map(&lib.mPlatformTypes, readPlatformType);
+    r.map(&lib.mPlatforms, [&r, &readPlatformType](Platform *platform) {
+        r.map(&platform->mPlatformTypes, readPlatformType);
+    });
+
+    r.map(&lib.functionwarn, [&r](WarnInfo *wi) {
+        wi->message = r.str();
+        wi->standards.c = static_cast<Standards::cstd_t>(r.u8());
+        wi->standards.cpp = static_cast<Standards::cppstd_t>(r.u8());
+        wi->standards.posix = r.u8() != 0;
+        wi->severity = static_cast<Severity::SeverityType>(r.u8());
+    });
+    r.map(&lib.containers, [&r](Container *container) {
+        container->startPattern = r.str();
+        container->endPattern = r.str();
+        container->itEndPattern = r.str();
+        r.map(&container->functions, [&r](Container::Function *f) {
+            f->action = static_cast<Container::Action>(r.u8());
+            f->yield = static_cast<Container::Yield>(r.u8());
+        });
+        container->type_templateArgNo = r.i32();
+        container->size_templateArgNo = r.i32();
+        container->arrayLike_indexOp = r.u8() != 0;
+        container->stdStringLike = r.u8() != 0;
+        container->opLessAllowed = r.u8() != 0;
+    });
+    for (int n = r.count(); n > 0; --n) {
+        const std::string name = r.str();
+        Function &f = lib.functions[name];
+        const std::size_t offset = r.pos() + 4 - data.data();
+        const int size = r.skipStr();
+        if (size > 4) {
+            // read the argument checks when they are needed
+            LazyArgumentChecks &lazy = lib.mLazyArgumentChecks[name];
+            const std::string::size_type pos = name.rfind(':');
+            lazy.name = (pos == std::string::npos) ? name : name.substr(pos + 1);
+            lazy.offset = offset;
+            lazy.size = static_cast<std::size_t>(size);
+        }
+        f.use = r.u8() != 0;
+        f.leakignore = r.u8() != 0;
+        f.isconst = r.u8() != 0;
+        f.ispure = r.u8() != 0;
+        f.useretval = r.u8() != 0;
+        f.ignore = r.u8() != 0;
+        f.formatstr = r.u8() != 0;
+        f.formatstr_scan = r.u8() != 0;
+        f.formatstr_secure = r.u8() != 0;
+    }
+    lib.returnuninitdata = r.strings();
+    for (int n = r.count(); n > 0; --n)
+        lib.defines.push_back(r.str());
+
+    if (!r.ok() || !r.atEnd())
+        return false;
+
+    if (!lib.mLazyArgumentChecks.empty())
+        lib.mBinaryData = std::make_shared<const std::string>(data);
+    lib.mCacheDir = mCacheDir;
+    lib.mCacheKey = 0;
+    *this = std::move(lib);
+    return true;
+}
+
+void Library::loadFunctions(const TokenList &tokenList)
+{
+    loadLazyFunctions(&tokenList);
+}
+
+void Library::loadLazyFunctions(const TokenList *tokenList)
+{
+    for (std::unordered_map<std::string, LazyArgumentChecks>::iterator it = mLazyArgumentChecks.begin(); it != mLazyArgumentChecks.end();) {
+        if (tokenList && !tokenList->mayContainName(it->second.name)) {
+            ++it;
+            continue;
+        }
+        const char *start = mBinaryData->data() + it->second.offset;
+        BinaryReader r(start, start + it->second.size);
+        Function &f = functions[it->first];
+        f.argumentChecks.clear();
+        readArgumentChecks(r, &f.argumentChecks);
+        it = mLazyArgumentChecks.erase(it);
+    }
+    if (mLazyArgumentChecks.empty()) {
+        mBinaryData.reset();
+        mLateArgumentChecks.clear();
+    }
+}
+
+// protects Library::mLateArgumentChecks
+static std::mutex lateArgumentChecksMutex;
+
+const std::map<int, Library::ArgumentChecks> &Library::getArgumentChecks(const std::string &functionName, const Function &function) const
+{
+    if (mLazyArgumentChecks.empty())
+        return function.argumentChecks;
+    const std::unordered_map<std::string, LazyArgumentChecks>::const_iterator lazy = mLazyArgumentChecks.find(functionName);
+    if (lazy == mLazyArgumentChecks.cend())
+        return function.argumentChecks;
+
+    // The function was not seen by loadFunctions(). Don't modify the function, checks may run in parallel.
+    std::lock_guard<std::mutex> lock(lateArgumentChecksMutex);
+    const std::map<std::string, std::map<int, ArgumentChecks> >::const_iterator late = mLateArgumentChecks.find(functionName);
+    if (late != mLateArgumentChecks.cend())
+        return late->second;
+    std::map<int, ArgumentChecks> &argumentChecks = mLateArgumentChecks[functionName];
+    const char *start = mBinaryData->data() + lazy->second.offset;
+    BinaryReader r(start, start + lazy->second.size);
+    readArgumentChecks(r, &argumentChecks);
+    return argumentChecks;
+}
+
 Library::Error Library::load(const tinyxml2::XMLDocument &doc)
 {
     const tinyxml2::XMLElement * const rootnode = doc.FirstChildElement();
@@ -140,6 +677,11 @@ Library::Error Library::load(const tinyxml2::XMLDocument &doc)
     if (rootnode == nullptr)
         return Error(BAD_XML);
 
+    mCacheKey = 0;
+
+    // functions are merged with the loaded ones
+    loadLazyFunctions(nullptr);
+
     if (strcmp(rootnode->Name(),"def") != 0)
         return Error(UNSUPPORTED_FORMAT, rootnode->Name());
 
@@ -160,7 +702,7 @@ Library::Error Library::load(const tinyxml2::XMLDocument &doc)
             int allocationId = 0;
             for (const tinyxml2::XMLElement *memorynode = node->FirstChildElement(); memorynode; memorynode = memorynode->NextSiblingElement()) {
                 if (strcmp(memorynode->Name(),"dealloc")==0) {
-                    const std::map<std::string, AllocFunc>::const_iterator it = mDealloc.find(memorynode->GetText());
+                    const std::unordered_map<std::string, AllocFunc>::const_iterator it = mDealloc.find(memorynode->GetText());
                     if (it != mDealloc.end()) {
                         allocationId = it->second.groupId;
                         break;
@@ -803,6 +1345,9 @@ std::string Library::getFunctionName(const Token *ftok, bool *error) const
 
 std::string Library::getFunctionName(const Token *ftok) const
 {
+    if (ftok->libraryFunction() && ftok->libraryFunction()->library == this)
+        return ftok->libraryFunction()->name;
+
     if (!Token::Match(ftok, "%name% (") && (ftok->strAt(-1) != "&" || ftok->previous()->astOperand2()))
         return "";
 
@@ -868,6 +1413,16 @@ const Library::AllocFunc* Library::dealloc(const Token *tok) const
     return isNotLibraryFunction(tok) && functions.find(funcname) != functions.end() ? nullptr : getAllocDealloc(mDealloc, funcname);
 }
 
+std::vector<std::string> Library::allocDeallocNames() const
+{
+    std::vector<std::string> names;
+    for (std::unordered_map<std::string, AllocFunc>::const_iterator it = mAlloc.begin(); it != mAlloc.end(); ++it)
+        names.push_back(it->first);
+    for (std::unordered_map<std::string, AllocFunc>::const_iterator it = mDealloc.begin(); it != mDealloc.end(); ++it)
+        names.push_back(it->first);
+    return names;
+}
+
 /** get allocation id for function */
 int Library::alloc(const Token *tok, int arg) const
 {
@@ -890,11 +1445,12 @@ const Library::ArgumentChecks * Library::getarg(const Token *ftok, int argnr) co
     const std::map<std::string, Function>::const_iterator it1 = functions.find(getFunctionName(ftok));
     if (it1 == functions.cend())
         return nullptr;
-    const std::map<int,ArgumentChecks>::const_iterator it2 = it1->second.argumentChecks.find(argnr);
-    if (it2 != it1->second.argumentChecks.cend())
+    const std::map<int, ArgumentChecks> &argumentChecks = getArgumentChecks(it1->first, it1->second);
+    const std::map<int,ArgumentChecks>::const_iterator it2 = argumentChecks.find(argnr);
+    if (it2 != argumentChecks.cend())
         return &it2->second;
-    const std::map<int,ArgumentChecks>::const_iterator it3 = it1->second.argumentChecks.find(-1);
-    if (it3 != it1->second.argumentChecks.cend())
+    const std::map<int,ArgumentChecks>::const_iterator it3 = argumentChecks.find(-1);
+    if (it3 != argumentChecks.cend())
         return &it3->second;
     return nullptr;
 }
@@ -988,6 +1544,9 @@ bool Library::isContainerYield(const Token * const cond, Library::Container::Yie
 // returns true if ftok is not a library function
 bool Library::isNotLibraryFunction(const Token *ftok) const
 {
+    if (ftok->libraryFunction() && ftok->libraryFunction()->library == this)
+        return ftok->isNotLibraryFunction();
+
     if (ftok->function() && ftok->function()->nestedIn && ftok->function()->nestedIn->type != Scope::eGlobal)
         return true;
 
@@ -1006,7 +1565,8 @@ bool Library::matchArguments(const Token *ftok, const std::string &functionName)
         return (callargs == 0);
     int args = 0;
     int firstOptionalArg = -1;
-    for (std::map<int, ArgumentChecks>::const_iterator it2 = it->second.argumentChecks.cbegin(); it2 != it->second.argumentChecks.cend(); ++it2) {
+    const std::map<int, ArgumentChecks> &argumentChecks = getArgumentChecks(functionName, it->second);
+    for (std::map<int, ArgumentChecks>::const_iterator it2 = argumentChecks.cbegin(); it2 != argumentChecks.cend(); ++it2) {
         if (it2->first > args)
             args = it2->first;
         if (it2->second.optional && (firstOptionalArg == -1 || firstOptionalArg > it2->first))
@@ -1041,7 +1601,8 @@ bool Library::formatstr_function(const Token* ftok) const
 
 int Library::formatstr_argno(const Token* ftok) const
 {
-    const std::map<int, Library::ArgumentChecks>& argumentChecksFunc = functions.at(getFunctionName(ftok)).argumentChecks;
+    const std::string functionName = getFunctionName(ftok);
+    const std::map<int, Library::ArgumentChecks>& argumentChecksFunc = getArgumentChecks(functionName, functions.at(functionName));
     for (std::map<int, Library::ArgumentChecks>::const_iterator i = argumentChecksFunc.cbegin(); i != argumentChecksFunc.cend(); ++i) {
         if (i->second.formatstr) {
             return i->first - 1;
@@ -1074,7 +1635,7 @@ const std::string& Library::returnValue(const Token *ftok) const
 {
     if (isNotLibraryFunction(ftok))
         return emptyString;
-    const std::map<std::string, std::string>::const_iterator it = mReturnValue.find(getFunctionName(ftok));
+    const std::unordered_map<std::string, std::string>::const_iterator it = mReturnValue.find(getFunctionName(ftok));
     return it != mReturnValue.end() ? it->second : emptyString;
 }
 
@@ -1082,7 +1643,7 @@ const std::string& Library::returnValueType(const Token *ftok) const
 {
     if (isNotLibraryFunction(ftok))
         return emptyString;
-    const std::map<std::string, std::string>::const_iterator it = mReturnValueType.find(getFunctionName(ftok));
+    const std::unordered_map<std::string, std::string>::const_iterator it = mReturnValueType.find(getFunctionName(ftok));
     return it != mReturnValueType.end() ? it->second : emptyString;
 }
 
@@ -1090,7 +1651,7 @@ int Library::returnValueContainer(const Token *ftok) const
 {
     if (isNotLibraryFunction(ftok))
         return -1;
-    const std::map<std::string, int>::const_iterator it = mReturnValueContainer.find(getFunctionName(ftok));
+    const std::unordered_map<std::string, int>::const_iterator it = mReturnValueContainer.find(getFunctionName(ftok));
     return it != mReturnValueContainer.end() ? it->second : -1;
 }
 
@@ -1099,7 +1660,8 @@ bool Library::hasminsize(const std::string &functionName) const
     const std::map<std::string, Function>::const_iterator it1 = functions.find(functionName);
     if (it1 == functions.cend())
         return false;
-    for (std::map<int, ArgumentChecks>::const_iterator it2 = it1->second.argumentChecks.cbegin(); it2 != it1->second.argumentChecks.cend(); ++it2) {
+    const std::map<int, ArgumentChecks> &argumentChecks = getArgumentChecks(functionName, it1->second);
+    for (std::map<int, ArgumentChecks>::const_iterator it2 = argumentChecks.cbegin(); it2 != argumentChecks.cend(); ++it2) {
         if (!it2->second.minsizes.empty())
             return true;
     }
@@ -1149,7 +1711,7 @@ bool Library::isnoreturn(const Token *ftok) const
         return true;
     if (isNotLibraryFunction(ftok))
         return false;
-    const std::map<std::string, bool>::const_iterator it = mNoReturn.find(getFunctionName(ftok));
+    const std::unordered_map<std::string, bool>::const_iterator it = mNoReturn.find(getFunctionName(ftok));
     return (it != mNoReturn.end() && it->second);
 }
 
@@ -1159,7 +1721,7 @@ bool Library::isnotnoreturn(const Token *ftok) const
         return false;
     if (isNotLibraryFunction(ftok))
         return false;
-    const std::map<std::string, bool>::const_iterator it = mNoReturn.find(getFunctionName(ftok));
+    const std::unordered_map<std::string, bool>::const_iterator it = mNoReturn.find(getFunctionName(ftok));
     return (it != mNoReturn.end() && !it->second);
 }
 
@@ -28,12 +28,15 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 class Token;
+class TokenList;
 
 namespace tinyxml2 {
     class XMLDocument;
@@ -70,6 +73,45 @@ public:
     /** this is primarily meant for unit tests. it only returns true/false */
     bool loadxmldata(const char xmldata[], std::size_t len);
 
+    /**
+     * Cache loaded .cfg files in given directory. The first time a
+     * .cfg file is loaded, a binary snapshot of the library is written
+     * to the directory. Later runs that load the same .cfg files in the
+     * same order read the snapshot instead of parsing the XML. A
+     * snapshot is identified by a hash of the file contents.
+     */
+    void setCacheDir(const std::string &dir) {
+        mCacheDir = dir;
+    }
+
+    /** Absolute paths of the loaded .cfg files */
+    const std::set<std::string> &getFiles() const {
+        return mFiles;
+    }
+
+    /** Hash of the contents of the loaded .cfg files, 0 if the library was changed in another way */
+    unsigned long long getCacheKey() const {
+        return mCacheKey;
+    }
+
+    /** Binary snapshot of the library */
+    std::string saveBinary() const;
+
+    /**
+     * Replace the library with a snapshot from saveBinary(). The
+     * argument checks of the functions are not read until they are
+     * needed, see loadFunctions().
+     * @return false if the data is invalid or was written by another cppcheck version
+     */
+    bool loadBinary(const std::string &data);
+
+    /**
+     * Read the argument checks of the functions that may be called in
+     * the token list, if they were not read by loadBinary(). Checks for
+     * other functions are read when they are first used. Not thread safe.
+     */
+    void loadFunctions(const TokenList &tokenList);
+
     struct AllocFunc {
         int groupId;
         int arg;
@@ -120,6 +162,9 @@ public:
         mDealloc[functionname].arg = arg;
     }
 
+    /** names of all allocation and deallocation functions */
+    std::vector<std::string> allocDeallocNames() const;
+
     /** add noreturn function setting */
     void setnoreturn(const std::string& funcname, bool noreturn) {
         mNoReturn[funcname] = noreturn;
@@ -276,6 +321,7 @@ public:
         Function() : use(false), leakignore(false), isconst(false), ispure(false), useretval(false), ignore(false), formatstr(false), formatstr_scan(false), formatstr_secure(false) {}
     };
 
+    /** The argument checks of functions from loadBinary() may not be read yet, see loadFunctions() */
     std::map<std::string, Function> functions;
     bool isUse(const std::string& functionName) const;
     bool isLeakIgnore(const std::string& functionName) const;
@@ -455,6 +501,12 @@ private:
         bool isSuffix(const std::string& suffix) const {
             return (mSuffixes.find(suffix) != mSuffixes.end());
         }
+        const std::set<std::string> &prefixes() const {
+            return mPrefixes;
+        }
+        const std::set<std::string> &suffixes() const {
+            return mSuffixes;
+        }
 
     private:
         std::set<std::string> mPrefixes;
@@ -488,6 +540,9 @@ private:
         bool isBlock(const std::string& blockName) const {
             return mBlocks.find(blockName) != mBlocks.end();
         }
+        const std::set<std::string> &blocks() const {
+            return mBlocks;
+        }
 
     private:
         std::string mStart;
@@ -497,12 +552,14 @@ private:
     };
     int mAllocId;
     std::set<std::string> mFiles;
-    std::map<std::string, AllocFunc> mAlloc; // allocation functions
-    std::map<std::string, AllocFunc> mDealloc; // deallocation functions
-    std::map<std::string, bool> mNoReturn; // is function noreturn?
-    std::map<std::string, std::string> mReturnValue;
-    std::map<std::string, std::string> mReturnValueType;
-    std::map<std::string, int> mReturnValueContainer;
+    std::string mCacheDir;
+    unsigned long long mCacheKey; // hash of the loaded .cfg files, 0 if the library was changed in another way
+    std::unordered_map<std::string, AllocFunc> mAlloc; // allocation functions
+    std::unordered_map<std::string, AllocFunc> mDealloc; // deallocation functions
+    std::unordered_map<std::string, bool> mNoReturn; // is function noreturn?
+    std::unordered_map<std::string, std::string> mReturnValue;
+    std::unordered_map<std::string, std::string> mReturnValueType;
+    std::unordered_map<std::string, int> mReturnValueContainer;
     std::map<std::string, bool> mReportErrors;
     std::map<std::string, bool> mProcessAfterCode;
     std::set<std::string> mMarkupExtensions; // file extensions of markup files
@@ -517,10 +574,26 @@ private:
 
     const ArgumentChecks * getarg(const Token *ftok, int argnr) const;
 
+    /** Argument checks of a function, they are read from the binary snapshot if needed */
+    const std::map<int, ArgumentChecks> &getArgumentChecks(const std::string &functionName, const Function &function) const;
+
+    /** Read lazy argument checks of the functions that may be called in the token list, or all if it is null */
+    void loadLazyFunctions(const TokenList *tokenList);
+
+    /** Argument checks in the binary snapshot that are not read yet */
+    struct LazyArgumentChecks {
+        std::string name; // function name without scope
+        std::size_t offset;
+        std::size_t size;
+    };
+    std::shared_ptr<const std::string> mBinaryData;
+    std::unordered_map<std::string, LazyArgumentChecks> mLazyArgumentChecks;
+    mutable std::map<std::string, std::map<int, ArgumentChecks> > mLateArgumentChecks; // read by getArgumentChecks()
+
     std::string getFunctionName(const Token *ftok, bool *error) const;
 
-    static const AllocFunc* getAllocDealloc(const std::map<std::string, AllocFunc> &data, const std::string &name) {
-        const std::map<std::string, AllocFunc>::const_iterator it = data.find(name);
+    static const AllocFunc* getAllocDealloc(const std::unordered_map<std::string, AllocFunc> &data, const std::string &name) {
+        const std::unordered_map<std::string, AllocFunc>::const_iterator it = data.find(name);
         return (it == data.end()) ? nullptr : &it->second;
     }
 };
@@ -27,6 +27,7 @@ Settings::Settings()
       debugSimplified(false),
       debugnormal(false),
       debugwarnings(false),
+      debugPeephole(false),
       dump(false),
       exceptionHandling(false),
       inconclusive(false),
@@ -40,10 +41,14 @@ Settings::Settings()
       xml(false), xml_version(2),
       jobs(1),
       loadAverage(0),
+      threads(1),
       exitCode(0),
       showtime(SHOWTIME_NONE),
       preprocessOnly(false),
       maxConfigs(12),
+      valueFlowMaxValues(ValueFlow::DEFAULT_MAX_VALUES),
+      valueFlowMaxFunctionValues(1000),
+      valueFlowAnalyses(~0U),
       enforcedLang(None),
       reportProgress(false),
       checkConfiguration(false),
@@ -27,6 +27,7 @@
 #include "library.h"
 #include "platform.h"
 #include "standards.h"
+#include "summaries.h"
 #include "suppressions.h"
 #include "timer.h"
 
@@ -82,6 +83,9 @@ public:
     /** @brief Is --debug-warnings given? */
     bool debugwarnings;
 
+    /** @brief Is --debug-peephole given? Verify fused token simplifications against the separate passes */
+    bool debugPeephole;
+
     /** @brief Is --dump given? */
     bool dump;
     std::string dumpFile;
@@ -152,6 +156,10 @@ public:
     /** @brief Load average value */
     unsigned int loadAverage;
 
+    /** @brief How many threads are used for the analysis of one file.
+        Default is 1. (--threads=N) */
+    unsigned int threads;
+
     /** @brief If errors are found, this value is returned from main().
         Default value is 0. */
     int exitCode;
@@ -178,6 +186,20 @@ public:
         Default is 12. (--max-configs=N) */
     unsigned int maxConfigs;
 
+    /** @brief Maximum number of ValueFlow values per token. Extra values
+        are dropped. Default is 10. (--valueflow-max-values=N) */
+    unsigned int valueFlowMaxValues;
+
+    /** @brief Maximum number of ValueFlow values that are passed from
+        function calls into the parameters of one function. Default is 1000.
+        (--valueflow-max-function-values=N) */
+    unsigned int valueFlowMaxFunctionValues;
+
+    /** @brief ValueFlow analyses (ValueFlow::Analysis flags) that are done.
+        Default is all. CppCheck leaves out the analyses that no check
+        with unsuppressed messages uses. */
+    unsigned int valueFlowAnalyses;
+
     /**
      * @brief Returns true if given id is in the list of
      * enabled extra checks (--enable)
@@ -247,6 +269,9 @@ public:
     /** Library (--library) */
     Library library;
 
+    /** Function summaries of other translation units (--cppcheck-build-dir) */
+    Summaries summaries;
+
     /** Rule */
     class CPPCHECKLIB Rule {
     public:
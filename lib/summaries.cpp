@@ -0,0 +1,294 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "summaries.h"
+
+#include "astutils.h"
+#include "library.h"
+#include "settings.h"
+#include "symboldatabase.h"
+#include "token.h"
+#include "tokenize.h"
+
+#include <cstddef>
+#include <sstream>
+
+/** Is the token in a lambda in the function scope? */
+static bool isInLambda(const Token *tok, const Scope *functionScope)
+{
+    for (const Scope *scope = tok->scope(); scope && scope != functionScope; scope = scope->nestedIn) {
+        if (scope->type == Scope::eLambda)
+            return true;
+    }
+    return false;
+}
+
+/** Pointer arguments that are dereferenced before the first condition/call/jump in the function body */
+static std::set<unsigned int> getDerefArgs(const Scope *scope, const Settings *settings)
+{
+    std::map<unsigned int, unsigned int> pointerArgs;
+    for (unsigned int argnr = 0; argnr < scope->function->argCount(); ++argnr) {
+        const Variable *arg = scope->function->getArgumentVar(argnr);
+        if (arg && arg->isPointer() && arg->declarationId())
+            pointerArgs[arg->declarationId()] = argnr + 1;
+    }
+
+    std::set<unsigned int> derefArgs;
+    const Token *end = scope->bodyEnd;
+    for (const Token *tok = scope->bodyStart->next(); tok && tok != end && !pointerArgs.empty(); tok = tok->next()) {
+        if (Token::Match(tok, "sizeof|decltype|typeof|alignof (")) {
+            tok = tok->linkAt(1);
+            continue;
+        }
+        if (tok->str() == "return") {
+            // the return expression is evaluated
+            end = Token::findsimplematch(tok, ";", scope->bodyEnd);
+            continue;
+        }
+        if (Token::Match(tok, "if|for|while|do|switch|goto|break|continue|throw|try|case|default|&&|%oror%|?|{|}"))
+            break;
+        if (Token::Match(tok, "%name% (") &&
+            !settings->library.isnotnoreturn(tok) &&
+            !(tok->function() && tok->function()->hasBody() && !tok->function()->isAttributeNoreturn()))
+            break;
+
+        const std::map<unsigned int, unsigned int>::iterator arg = pointerArgs.find(tok->varId());
+        if (!tok->varId() || arg == pointerArgs.end())
+            continue;
+        const Token *parent = tok->astParent();
+        if (!parent)
+            continue;
+
+        // pointer is changed => stop tracking it
+        if ((parent->str() == "=" && parent->astOperand1() == tok) || (parent->str() == "&" && !parent->astOperand2())) {
+            pointerArgs.erase(arg);
+            continue;
+        }
+
+        if ((parent->str() == "*" && !parent->astOperand2()) ||
+            (parent->str() == "[" && parent->astOperand1() == tok) ||
+            (parent->originalName() == "->" && parent->astOperand1() == tok))
+            derefArgs.insert(arg->second);
+    }
+    return derefArgs;
+}
+
+static std::string getKey(const std::string &functionName, std::size_t argCount)
+{
+    return functionName + '/' + std::to_string(argCount);
+}
+
+static void write(std::ostream &ostr, const std::string &key, const Summaries::Function &summary)
+{
+    ostr << key;
+    if (summary.noreturn)
+        ostr << " noreturn";
+    if (!summary.returnValues.empty()) {
+        ostr << " return:";
+        for (std::set<MathLib::bigint>::const_iterator it = summary.returnValues.begin(); it != summary.returnValues.end(); ++it)
+            ostr << (it == summary.returnValues.begin() ? "" : ",") << *it;
+    }
+    if (!summary.derefArgs.empty()) {
+        ostr << " deref:";
+        for (std::set<unsigned int>::const_iterator it = summary.derefArgs.begin(); it != summary.derefArgs.end(); ++it)
+            ostr << (it == summary.derefArgs.begin() ? "" : ",") << *it;
+    }
+    ostr << '\n';
+}
+
+std::string Summaries::create(const Tokenizer *tokenizer, const Settings *settings)
+{
+    std::map<std::string, Function> summaries;
+    std::set<std::string> overloads;
+    const SymbolDatabase *symbolDatabase = tokenizer->getSymbolDatabase();
+    for (const Scope *scope : symbolDatabase->functionScopes) {
+        const ::Function *function = scope->function;
+        if (!function || function->isStatic() || function->isOperator() || !function->nestedIn || function->nestedIn->type != Scope::eGlobal)
+            continue;
+        if (function->name().find('<') != std::string::npos || function->isVariadic())
+            continue;
+
+        bool hasReturn = false;
+        bool unknownReturnValue = false;
+        std::set<MathLib::bigint> returnValues;
+        for (const Token *tok = scope->bodyStart; tok != scope->bodyEnd; tok = tok->next()) {
+            if (tok->str() != "return" || isInLambda(tok, scope))
+                continue;
+            hasReturn = true;
+            const Token *expr = tok->astOperand1();
+            if (expr && expr->hasKnownIntValue())
+                returnValues.insert(expr->values().front().intvalue);
+            else
+                unknownReturnValue = true;
+        }
+        if (unknownReturnValue || returnValues.size() > settings->valueFlowMaxValues)
+            returnValues.clear();
+
+        std::string unknownFunc;
+        const bool noreturn = function->isAttributeNoreturn() ||
+                              (!hasReturn && settings->summaries.isScopeNoReturn(scope->bodyEnd, settings->library, &unknownFunc) && unknownFunc.empty());
+
+        // overloads with the same number of arguments can't be told apart at the call
+        const std::string key = getKey(function->name(), function->argCount());
+        if (!summaries.insert(std::make_pair(key, Function())).second) {
+            overloads.insert(key);
+            continue;
+        }
+        Function &summary = summaries[key];
+        summary.noreturn = noreturn;
+        summary.returnValues.swap(returnValues);
+        summary.derefArgs = getDerefArgs(scope, settings);
+    }
+
+    std::ostringstream ostr;
+    for (std::map<std::string, Function>::const_iterator it = summaries.begin(); it != summaries.end(); ++it) {
+        if (overloads.find(it->first) == overloads.end())
+            write(ostr, it->first, it->second);
+    }
+    return ostr.str();
+}
+
+/** Parse comma separated numbers */
+template<class T>
+static void parseList(const std::string &str, std::set<T> *values)
+{
+    std::istringstream istr(str);
+    std::string value;
+    while (std::getline(istr, value, ','))
+        values->insert(static_cast<T>(MathLib::toLongNumber(value)));
+}
+
+void Summaries::setSummaries(const std::string &translationUnit, const std::string &summaries)
+{
+    std::map<std::string, Function> &functions = mFiles[translationUnit];
+    for (std::map<std::string, Function>::const_iterator it = functions.begin(); it != functions.end(); ++it) {
+        std::set<std::string> &files = mDefinitions[it->first];
+        files.erase(translationUnit);
+        if (files.empty())
+            mDefinitions.erase(it->first);
+    }
+    functions.clear();
+
+    std::istringstream istr(summaries);
+    std::string line;
+    while (std::getline(istr, line)) {
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name))
+            continue;
+        Function function;
+        std::string field;
+        while (fields >> field) {
+            if (field == "noreturn")
+                function.noreturn = true;
+            else if (field.compare(0, 7, "return:") == 0)
+                parseList(field.substr(7), &function.returnValues);
+            else if (field.compare(0, 6, "deref:") == 0)
+                parseList(field.substr(6), &function.derefArgs);
+        }
+        functions[name] = function;
+        mDefinitions[name].insert(translationUnit);
+    }
+
+    if (functions.empty())
+        mFiles.erase(translationUnit);
+}
+
+bool Summaries::find(const std::string &functionName, unsigned int argCount, Function *summary) const
+{
+    const std::string key = getKey(functionName, argCount);
+    const std::map<std::string, std::set<std::string> >::const_iterator definitions = mDefinitions.find(key);
+    if (definitions == mDefinitions.end())
+        return false;
+
+    bool first = true;
+    for (const std::string &file : definitions->second) {
+        const Function &function = mFiles.at(file).at(key);
+        if (first) {
+            *summary = function;
+            first = false;
+            continue;
+        }
+        summary->noreturn &= function.noreturn;
+        if (function.returnValues.empty())
+            summary->returnValues.clear();
+        else if (!summary->returnValues.empty())
+            summary->returnValues.insert(function.returnValues.begin(), function.returnValues.end());
+        std::set<unsigned int> derefArgs;
+        for (unsigned int argnr : function.derefArgs) {
+            if (summary->derefArgs.find(argnr) != summary->derefArgs.end())
+                derefArgs.insert(argnr);
+        }
+        summary->derefArgs.swap(derefArgs);
+    }
+    return true;
+}
+
+bool Summaries::find(const Token *ftok, Function *summary) const
+{
+    if (mDefinitions.empty() || !Token::Match(ftok, "%name% (") || Token::Match(ftok->previous(), ".|::"))
+        return false;
+
+    // summaries are only created for global functions, calls of functions with a body are analysed directly
+    const ::Function *function = ftok->function();
+    if (function && (function->hasBody() || !function->nestedIn || function->nestedIn->type != Scope::eGlobal))
+        return false;
+
+    return find(ftok->str(), static_cast<unsigned int>(numberOfArguments(ftok)), summary);
+}
+
+std::set<std::string> Summaries::getCalledFunctions(const Tokenizer *tokenizer)
+{
+    std::set<std::string> functionNames;
+    for (const Token *tok = tokenizer->tokens(); tok; tok = tok->next()) {
+        if (Token::Match(tok, "%name% (") && !tok->isKeyword() && !tok->varId() && !(tok->function() && tok->function()->hasBody()))
+            functionNames.insert(tok->str());
+    }
+    return functionNames;
+}
+
+std::string Summaries::getSummaries(const std::set<std::string> &functionNames) const
+{
+    std::ostringstream ostr;
+    for (std::map<std::string, std::set<std::string> >::const_iterator it = mDefinitions.begin(); it != mDefinitions.end(); ++it) {
+        const std::string::size_type slash = it->first.rfind('/');
+        if (functionNames.find(it->first.substr(0, slash)) == functionNames.end())
+            continue;
+        Function summary;
+        if (find(it->first.substr(0, slash), static_cast<unsigned int>(MathLib::toULongNumber(it->first.substr(slash + 1))), &summary))
+            write(ostr, it->first, summary);
+    }
+    return ostr.str();
+}
+
+bool Summaries::isScopeNoReturn(const Token *end, const Library &library, std::string *unknownFunc) const
+{
+    std::string unknown;
+    bool ret = library.isScopeNoReturn(end, &unknown);
+
+    // Function defined in another translation unit?
+    Function summary;
+    if (!unknown.empty() && find(end->linkAt(-2)->previous(), &summary)) {
+        ret = summary.noreturn;
+        unknown.clear();
+    }
+
+    if (unknownFunc)
+        *unknownFunc = unknown;
+    return ret;
+}
@@ -0,0 +1,112 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef summariesH
+#define summariesH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+#include "mathlib.h"
+
+#include <map>
+#include <set>
+#include <string>
+
+class Library;
+class Settings;
+class Token;
+class Tokenizer;
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Function summaries that are shared between translation units.
+ *
+ * When --cppcheck-build-dir is used, a summary of each global function
+ * is stored with the analyzer information of the translation unit that
+ * defines it. It is only replaced when the translation unit is analyzed
+ * again, i.e. when it has changed. When another translation unit calls
+ * the function, the summary is used instead of assuming that nothing is
+ * known about the function.
+ *
+ * The summaries are identified by the function name and the number of
+ * arguments. Overloads with the same number of arguments don't get a
+ * summary.
+ */
+class CPPCHECKLIB Summaries {
+public:
+    /** @brief Facts about a function */
+    struct Function {
+        Function() : noreturn(false) {}
+
+        /** the function never returns */
+        bool noreturn;
+
+        /** all values the function can return, empty if unknown */
+        std::set<MathLib::bigint> returnValues;
+
+        /** arguments (1 = first argument) that are always dereferenced */
+        std::set<unsigned int> derefArgs;
+    };
+
+    /** @brief Create summaries of the functions in the token list. The result is stored with AnalyzerInformation::setSummaries(). */
+    static std::string create(const Tokenizer *tokenizer, const Settings *settings);
+
+    /** @brief Replace the summaries of a translation unit */
+    void setSummaries(const std::string &translationUnit, const std::string &summaries);
+
+    /**
+     * @brief Get the summary of a function. If the function is defined in
+     * several translation units the summaries are combined so only facts
+     * that are true for all definitions are kept.
+     * @return false if there is no summary for the function
+     */
+    bool find(const std::string &functionName, unsigned int argCount, Function *summary) const;
+
+    /**
+     * @brief Get the summary of the function that is called at ftok. Only calls
+     * of global functions that are not defined in the current translation unit
+     * are looked up.
+     */
+    bool find(const Token *ftok, Function *summary) const;
+
+    /** @brief Names of the functions that are called in the token list and might be looked up in the summaries */
+    static std::set<std::string> getCalledFunctions(const Tokenizer *tokenizer);
+
+    /** @brief The summaries of the given functions, to see if they have changed since a translation unit was analyzed */
+    std::string getSummaries(const std::set<std::string> &functionNames) const;
+
+    /**
+     * @brief Wrapper for Library::isScopeNoReturn(). A function that is
+     * unknown to the library is looked up in the summaries.
+     */
+    bool isScopeNoReturn(const Token *end, const Library &library, std::string *unknownFunc) const;
+
+private:
+    /** summaries of each translation unit, the key is "name/argCount" */
+    std::map<std::string, std::map<std::string, Function> > mFiles;
+
+    /** translation units that define each function */
+    std::map<std::string, std::set<std::string> > mDefinitions;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // summariesH
@@ -290,6 +290,19 @@ bool Suppressions::isSuppressed(const Suppressions::ErrorMessage &errmsg)
     return false;
 }
 
+bool Suppressions::isSuppressedEverywhere(const std::string &errorId) const
+{
+    for (const Suppression &s : mSuppressions) {
+        if (s.lineNumber != Suppression::NO_LINE || !s.symbolName.empty())
+            continue;
+        if (!s.fileName.empty() && s.fileName != "*")
+            continue;
+        if (s.errorId.empty() || matchglob(s.errorId, errorId))
+            return true;
+    }
+    return false;
+}
+
 bool Suppressions::isSuppressedLocal(const Suppressions::ErrorMessage &errmsg)
 {
     const bool unmatchedSuppression(errmsg.errorId == "unmatchedSuppression");
@@ -304,7 +317,7 @@ bool Suppressions::isSuppressedLocal(const Suppressions::ErrorMessage &errmsg)
     return false;
 }
 
-void Suppressions::dump(std::ostream & out)
+void Suppressions::dump(std::ostream & out) const
 {
     out << "  <suppressions>" << std::endl;
     for (const Suppression &suppression : mSuppressions) {
@@ -144,11 +144,19 @@ public:
      */
     bool isSuppressedLocal(const ErrorMessage &errmsg);
 
+    /**
+     * @brief Returns true if all messages with the given id are suppressed,
+     * regardless of file, line and symbol.
+     * @param errorId error id
+     * @return true if the id is suppressed everywhere.
+     */
+    bool isSuppressedEverywhere(const std::string &errorId) const;
+
     /**
      * @brief Create an xml dump of suppressions
      * @param out stream to write XML to
     */
-    void dump(std::ostream &out);
+    void dump(std::ostream &out) const;
 
     /**
      * @brief Returns list of unmatched local (per-file) suppressions.
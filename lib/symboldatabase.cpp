@@ -22,6 +22,7 @@
 #include "errorlogger.h"
 #include "platform.h"
 #include "settings.h"
+#include "taskpool.h"
 #include "token.h"
 #include "tokenize.h"
 #include "tokenlist.h"
@@ -33,10 +34,11 @@
 #include <climits>
 #include <iomanip>
 #include <iostream>
+#include <unordered_map>
 //---------------------------------------------------------------------------
 
 SymbolDatabase::SymbolDatabase(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger)
-    : mTokenizer(tokenizer), mSettings(settings), mErrorLogger(errorLogger)
+    : mTokenizer(tokenizer), mSettings(settings), mErrorLogger(errorLogger), mScopesIndexed(0)
 {
     mIsCpp = isCPP();
 
@@ -62,6 +64,8 @@ SymbolDatabase::SymbolDatabase(const Tokenizer *tokenizer, const Settings *setti
     createSymbolDatabaseSetTypePointers();
     createSymbolDatabaseEnums();
     createSymbolDatabaseUnknownArrayDimensions();
+
+    indexScopes();
 }
 
 static const Token* skipScopeIdentifiers(const Token* tok)
@@ -254,13 +258,13 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
 
                 if (new_scope->type == Scope::eEnum) {
                     tok2 = new_scope->addEnum(tok, mTokenizer->isCPP());
-                    scope->nestedList.push_back(new_scope);
+                    scope->addNestedScope(new_scope);
 
                     if (!tok2)
                         mTokenizer->syntaxError(tok);
                 } else {
                     // make the new scope the current scope
-                    scope->nestedList.push_back(new_scope);
+                    scope->addNestedScope(new_scope);
                     scope = new_scope;
                 }
 
@@ -290,7 +294,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             }
 
             // make the new scope the current scope
-            scope->nestedList.push_back(new_scope);
+            scope->addNestedScope(new_scope);
             scope = &scopeList.back();
 
             tok = tok2;
@@ -379,7 +383,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             }
 
             // make the new scope the current scope
-            scope->nestedList.push_back(new_scope);
+            scope->addNestedScope(new_scope);
             scope = new_scope;
 
             tok = tok2;
@@ -413,7 +417,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             }
 
             // make the new scope the current scope
-            scope->nestedList.push_back(new_scope);
+            scope->addNestedScope(new_scope);
             scope = new_scope;
 
             tok = tok2;
@@ -619,7 +623,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
                     scopeList.emplace_back(this, tok, scope, Scope::eTry, tok1);
 
                 tok = tok1;
-                scope->nestedList.push_back(&scopeList.back());
+                scope->addNestedScope(&scopeList.back());
                 scope = &scopeList.back();
             } else if (Token::Match(tok, "if|for|while|catch|switch (") && Token::simpleMatch(tok->next()->link(), ") {")) {
                 const Token *scopeStartTok = tok->next()->link()->next();
@@ -634,7 +638,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
                 } else // if (tok->str() == "switch")
                     scopeList.emplace_back(this, tok, scope, Scope::eSwitch, scopeStartTok);
 
-                scope->nestedList.push_back(&scopeList.back());
+                scope->addNestedScope(&scopeList.back());
                 scope = &scopeList.back();
                 if (scope->type == Scope::eFor)
                     scope->checkVariable(tok->tokAt(2), Local, mSettings); // check for variable declaration and add it to new scope if found
@@ -653,11 +657,11 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
 
                     if (tok2 && tok2->str() == ")" && tok2->link()->strAt(-1) == "]") {
                         scopeList.emplace_back(this, tok2->link()->linkAt(-1), scope, Scope::eLambda, tok);
-                        scope->nestedList.push_back(&scopeList.back());
+                        scope->addNestedScope(&scopeList.back());
                         scope = &scopeList.back();
                     } else if (!Token::Match(tok->previous(), "=|,|(|return") && !(tok->strAt(-1) == ")" && Token::Match(tok->linkAt(-1)->previous(), "=|,|(|return"))) {
                         scopeList.emplace_back(this, tok, scope, Scope::eUnconditional, tok);
-                        scope->nestedList.push_back(&scopeList.back());
+                        scope->addNestedScope(&scopeList.back());
                         scope = &scopeList.back();
                     } else {
                         tok = tok->link();
@@ -674,7 +678,7 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
         return;
 
     // fill in using info
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         for (std::list<Scope::UsingInfo>::iterator i = it->usingList.begin(); i != it->usingList.end(); ++i) {
             // only find if not already found
             if (i->scope == nullptr) {
@@ -690,7 +694,7 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
     }
 
     // fill in base class info
-    for (std::list<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
+    for (ChunkedList<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
         // finish filling in base class info
         for (unsigned int i = 0; i < it->derivedFrom.size(); ++i) {
             const Type* found = findType(it->derivedFrom[i].nameTok, it->enclosingScope);
@@ -704,7 +708,7 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
     }
 
     // fill in friend info
-    for (std::list<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
+    for (ChunkedList<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
         for (std::vector<Type::FriendInfo>::iterator i = it->friendList.begin(); i != it->friendList.end(); ++i) {
             i->type = findType(i->nameStart, it->enclosingScope);
         }
@@ -714,31 +718,47 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
 
 void SymbolDatabase::createSymbolDatabaseVariableInfo()
 {
+    // Each scope and function only looks at its own tokens so they are
+    // handled on the thread pool. Debug messages are reported directly to
+    // the error logger, so then everything is done in this thread.
+    const unsigned int threads = mSettings->debugwarnings ? 1U : mSettings->threads;
+
     // fill in variable info
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
-        // find variables
-        it->getVariableList(mSettings);
+    std::vector<TaskPool::Task> tasks;
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        Scope *scope = &*it;
+        tasks.push_back([=]() {
+            // find variables
+            scope->getVariableList(mSettings);
+        });
     }
+    TaskPool::run(threads, tasks);
 
     // fill in function arguments
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
-        std::list<Function>::iterator func;
+    tasks.clear();
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        Scope *scope = &*it;
+        ChunkedList<Function>::iterator func;
 
         for (func = it->functionList.begin(); func != it->functionList.end(); ++func) {
-            // add arguments
-            func->addArguments(this, &*it);
+            Function *function = &*func;
+            tasks.push_back([=]() {
+                // add arguments
+                function->addArguments(this, scope);
+            });
         }
     }
+    TaskPool::run(threads, tasks);
 }
 
 void SymbolDatabase::createSymbolDatabaseCopyAndMoveConstructors()
 {
     // fill in class and struct copy/move constructors
-    for (std::list<Scope>::iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
+    for (ChunkedList<Scope>::iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
         if (!scope->isClassOrStruct())
             continue;
 
-        std::list<Function>::iterator func;
+        ChunkedList<Function>::iterator func;
         for (func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
             if (!func->isConstructor() || func->minArgCount() != 1)
                 continue;
@@ -761,7 +781,7 @@ void SymbolDatabase::createSymbolDatabaseCopyAndMoveConstructors()
 void SymbolDatabase::createSymbolDatabaseFunctionScopes()
 {
     // fill in function scopes
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->type == Scope::eFunction)
             functionScopes.push_back(&*it);
     }
@@ -770,7 +790,7 @@ void SymbolDatabase::createSymbolDatabaseFunctionScopes()
 void SymbolDatabase::createSymbolDatabaseClassAndStructScopes()
 {
     // fill in class and struct scopes
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->isClassOrStruct())
             classAndStructScopes.push_back(&*it);
     }
@@ -779,8 +799,8 @@ void SymbolDatabase::createSymbolDatabaseClassAndStructScopes()
 void SymbolDatabase::createSymbolDatabaseFunctionReturnTypes()
 {
     // fill in function return types
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
-        std::list<Function>::iterator func;
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        ChunkedList<Function>::iterator func;
 
         for (func = it->functionList.begin(); func != it->functionList.end(); ++func) {
             // add return types
@@ -802,7 +822,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
 {
     if (mTokenizer->isC()) {
         // For C code it is easy, as there are no constructors and no default values
-        for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
             Scope *scope = &(*it);
             if (scope->definedType)
                 scope->definedType->needInitialization = Type::True;
@@ -815,7 +835,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
         do {
             unknowns = 0;
 
-            for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+            for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
                 Scope *scope = &(*it);
 
                 if (!scope->definedType) {
@@ -827,7 +847,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
                     // check for default constructor
                     bool hasDefaultConstructor = false;
 
-                    std::list<Function>::const_iterator func;
+                    ChunkedList<Function>::const_iterator func;
 
                     for (func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
                         if (func->type == Function::eConstructor) {
@@ -856,7 +876,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
                         bool needInitialization = false;
                         bool unknown = false;
 
-                        std::list<Variable>::const_iterator var;
+                        ChunkedList<Variable>::const_iterator var;
                         for (var = scope->varlist.begin(); var != scope->varlist.end() && !needInitialization; ++var) {
                             if (var->isClass()) {
                                 if (var->type()) {
@@ -888,7 +908,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
 
         // this shouldn't happen so output a debug warning
         if (retry == 100 && mSettings->debugwarnings) {
-            for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+            for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
                 const Scope *scope = &(*it);
 
                 if (scope->isClassOrStruct() && scope->definedType->needInitialization == Type::Unknown)
@@ -905,11 +925,11 @@ void SymbolDatabase::createSymbolDatabaseVariableSymbolTable()
     std::fill_n(mVariableList.begin(), mVariableList.size(), (const Variable*)nullptr);
 
     // check all scopes for variables
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         Scope *scope = &(*it);
 
         // add all variables
-        for (std::list<Variable>::iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var) {
+        for (ChunkedList<Variable>::iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var) {
             const unsigned int varId = var->declarationId();
             if (varId)
                 mVariableList[varId] = &(*var);
@@ -922,8 +942,8 @@ void SymbolDatabase::createSymbolDatabaseVariableSymbolTable()
         }
 
         // add all function parameters
-        for (std::list<Function>::iterator func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
-            for (std::list<Variable>::iterator arg = func->argumentList.begin(); arg != func->argumentList.end(); ++arg) {
+        for (ChunkedList<Function>::iterator func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
+            for (ChunkedList<Variable>::iterator arg = func->argumentList.begin(); arg != func->argumentList.end(); ++arg) {
                 // check for named parameters
                 if (arg->nameToken() && arg->declarationId()) {
                     const unsigned int declarationId = arg->declarationId();
@@ -969,7 +989,7 @@ void SymbolDatabase::createSymbolDatabaseVariableSymbolTable()
 void SymbolDatabase::createSymbolDatabaseSetScopePointers()
 {
     // Set scope pointers
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         Token* start = const_cast<Token*>(it->bodyStart);
         Token* end = const_cast<Token*>(it->bodyEnd);
         if (it->type == Scope::eGlobal) {
@@ -983,7 +1003,7 @@ void SymbolDatabase::createSymbolDatabaseSetScopePointers()
         for (Token* tok = start; tok != end; tok = tok->next()) {
             if (start != end && tok->str() == "{") {
                 bool isEndOfScope = false;
-                for (std::list<Scope*>::const_iterator innerScope = it->nestedList.begin(); innerScope != it->nestedList.end(); ++innerScope) {
+                for (std::vector<Scope *>::const_iterator innerScope = it->nestedList.begin(); innerScope != it->nestedList.end(); ++innerScope) {
                     if (tok == (*innerScope)->bodyStart) { // Is begin of inner scope
                         tok = tok->link();
                         if (tok->next() == end || !tok->next()) {
@@ -1006,8 +1026,8 @@ void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
 {
     if (firstPass) {
         // Set function definition and declaration pointers
-        for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
-            for (std::list<Function>::const_iterator func = it->functionList.begin(); func != it->functionList.end(); ++func) {
+        for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+            for (ChunkedList<Function>::const_iterator func = it->functionList.begin(); func != it->functionList.end(); ++func) {
                 if (func->tokenDef)
                     const_cast<Token *>(func->tokenDef)->function(&*func);
 
@@ -1027,8 +1047,8 @@ void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
     }
 
     // Set C++ 11 delegate constructor function call pointers
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
-        for (std::list<Function>::const_iterator func = it->functionList.begin(); func != it->functionList.end(); ++func) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        for (ChunkedList<Function>::const_iterator func = it->functionList.begin(); func != it->functionList.end(); ++func) {
             // look for initializer list
             if (func->isConstructor() && func->functionScope && func->functionScope->functionOf && func->arg) {
                 const Token * tok = func->arg->link()->next();
@@ -1192,7 +1212,7 @@ void SymbolDatabase::createSymbolDatabaseSetVariablePointers()
 void SymbolDatabase::createSymbolDatabaseEnums()
 {
     // fill in enumerators in enum
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->type != Scope::eEnum)
             continue;
 
@@ -1202,7 +1222,7 @@ void SymbolDatabase::createSymbolDatabaseEnums()
     }
 
     // fill in enumerator values
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (ChunkedList<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->type != Scope::eEnum)
             continue;
 
@@ -2130,11 +2150,39 @@ void SymbolDatabase::addClassFunction(Scope **scope, const Token **tok, const To
     if (!tok1)
         return;
 
-    std::list<Scope>::iterator it1;
+    // Candidates in scopeList order: the scopes with the name tok1 and the
+    // current scope if it has using directives.
+    indexScopes();
+    std::vector<Scope *> candidates;
+    {
+        const std::unordered_map<std::string, std::vector<IndexedScope> >::const_iterator named = mScopesByName.find(tok1->str());
+        std::size_t current = 0;
+        bool addCurrent = false;
+        if (*scope && !(*scope)->usingList.empty()) {
+            for (const IndexedScope &s : mScopesByName[(*scope)->className]) {
+                if (s.scope == *scope) {
+                    current = s.index;
+                    addCurrent = true;
+                    break;
+                }
+            }
+        }
+        if (named != mScopesByName.end()) {
+            for (const IndexedScope &s : named->second) {
+                if (addCurrent && current <= s.index) {
+                    if (current < s.index)
+                        candidates.push_back(*scope);
+                    addCurrent = false;
+                }
+                candidates.push_back(s.scope);
+            }
+        }
+        if (addCurrent)
+            candidates.push_back(*scope);
+    }
 
     // search for match
-    for (it1 = scopeList.begin(); it1 != scopeList.end(); ++it1) {
-        Scope *scope1 = &(*it1);
+    for (Scope *scope1 : candidates) {
 
         bool match = false;
 
@@ -2278,7 +2326,7 @@ void SymbolDatabase::addNewFunction(Scope **scope, const Token **tok)
             return;
         }
 
-        (*scope)->nestedList.push_back(newScope);
+        (*scope)->addNestedScope(newScope);
         *scope = newScope;
         *tok = tok1;
     } else {
@@ -2684,14 +2732,14 @@ void SymbolDatabase::printOut(const char *title) const
     if (title)
         std::cout << "\n### " << title << " ###\n";
 
-    for (std::list<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
+    for (ChunkedList<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
         std::cout << "Scope: " << &*scope << " " << scope->type << std::endl;
         std::cout << "    className: " << scope->className << std::endl;
         std::cout << "    classDef: " << tokenToString(scope->classDef, mTokenizer) << std::endl;
         std::cout << "    bodyStart: " << tokenToString(scope->bodyStart, mTokenizer) << std::endl;
         std::cout << "    bodyEnd: " << tokenToString(scope->bodyEnd, mTokenizer) << std::endl;
 
-        std::list<Function>::const_iterator func;
+        ChunkedList<Function>::const_iterator func;
 
         // find the function body if not implemented inline
         for (func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
@@ -2772,7 +2820,7 @@ void SymbolDatabase::printOut(const char *title) const
             std::cout << "        nestedIn: " << scopeToString(func->nestedIn, mTokenizer) << std::endl;
             std::cout << "        functionScope: " << scopeToString(func->functionScope, mTokenizer) << std::endl;
 
-            std::list<Variable>::const_iterator var;
+            ChunkedList<Variable>::const_iterator var;
 
             for (var = func->argumentList.begin(); var != func->argumentList.end(); ++var) {
                 std::cout << "        Variable: " << &*var << std::endl;
@@ -2780,7 +2828,7 @@ void SymbolDatabase::printOut(const char *title) const
             }
         }
 
-        std::list<Variable>::const_iterator var;
+        ChunkedList<Variable>::const_iterator var;
 
         for (var = scope->varlist.begin(); var != scope->varlist.end(); ++var) {
             std::cout << "    Variable: " << &*var << std::endl;
@@ -2828,7 +2876,7 @@ void SymbolDatabase::printOut(const char *title) const
 
         std::cout << "    nestedList[" << scope->nestedList.size() << "] = (";
 
-        std::list<Scope *>::const_iterator nsi;
+        std::vector<Scope *>::const_iterator nsi;
 
         std::size_t count = scope->nestedList.size();
         for (nsi = scope->nestedList.begin(); nsi != scope->nestedList.end(); ++nsi) {
@@ -2859,7 +2907,7 @@ void SymbolDatabase::printOut(const char *title) const
         std::cout << std::endl;
     }
 
-    for (std::list<Type>::const_iterator type = typeList.begin(); type != typeList.end(); ++type) {
+    for (ChunkedList<Type>::const_iterator type = typeList.begin(); type != typeList.end(); ++type) {
         std::cout << "Type: " << &(*type) << std::endl;
         std::cout << "    name: " << type->name() << std::endl;
         std::cout << "    classDef: " << tokenToString(type->classDef, mTokenizer) << std::endl;
@@ -2929,7 +2977,7 @@ void SymbolDatabase::printXml(std::ostream &out) const
 
     // Scopes..
     out << "  <scopes>" << std::endl;
-    for (std::list<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
+    for (ChunkedList<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
         out << "    <scope";
         out << " id=\"" << &*scope << "\"";
         out << " type=\"" << scope->type << "\"";
@@ -2949,7 +2997,7 @@ void SymbolDatabase::printXml(std::ostream &out) const
             out << '>' << std::endl;
             if (!scope->functionList.empty()) {
                 out << "      <functionList>" << std::endl;
-                for (std::list<Function>::const_iterator function = scope->functionList.begin(); function != scope->functionList.end(); ++function) {
+                for (ChunkedList<Function>::const_iterator function = scope->functionList.begin(); function != scope->functionList.end(); ++function) {
                     out << "        <function id=\"" << &*function << "\" tokenDef=\"" << function->tokenDef << "\" name=\"" << ErrorLogger::toxml(function->name()) << '\"';
                     out << " type=\"" << (function->type == Function::eConstructor? "Constructor" :
                                           function->type == Function::eCopyConstructor ? "CopyConstructor" :
@@ -2980,7 +3028,7 @@ void SymbolDatabase::printXml(std::ostream &out) const
             }
             if (!scope->varlist.empty()) {
                 out << "      <varlist>" << std::endl;
-                for (std::list<Variable>::const_iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var)
+                for (ChunkedList<Variable>::const_iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var)
                     out << "        <var id=\""   << &*var << "\"/>" << std::endl;
                 out << "      </varlist>" << std::endl;
             }
@@ -3233,7 +3281,7 @@ const Function * Function::getOverridenFunctionRecursive(const ::Type* baseType,
 
 const Variable* Function::getArgumentVar(std::size_t num) const
 {
-    for (std::list<Variable>::const_iterator i = argumentList.begin(); i != argumentList.end(); ++i) {
+    for (ChunkedList<Variable>::const_iterator i = argumentList.begin(); i != argumentList.end(); ++i) {
         if (i->index() == num)
             return (&*i);
         else if (i->index() > num)
@@ -3311,7 +3359,7 @@ Scope::Scope(const SymbolDatabase *check_, const Token *classDef_, const Scope *
 bool Scope::hasDefaultConstructor() const
 {
     if (numConstructors) {
-        std::list<Function>::const_iterator func;
+        ChunkedList<Function>::const_iterator func;
 
         for (func = functionList.begin(); func != functionList.end(); ++func) {
             if (func->type == Function::eConstructor && func->argCount() == 0)
@@ -3517,7 +3565,7 @@ const Token *Scope::checkVariable(const Token *tok, AccessControl varaccess, con
 
 const Variable *Scope::getVariable(const std::string &varname) const
 {
-    std::list<Variable>::const_iterator iter;
+    ChunkedList<Variable>::const_iterator iter;
 
     for (iter = varlist.begin(); iter != varlist.end(); ++iter) {
         if (iter->name() == varname)
@@ -3721,7 +3769,7 @@ const Enumerator * SymbolDatabase::findEnumerator(const Token * tok) const
                     return enumerator;
                 // enum
                 else {
-                    for (std::list<Scope *>::const_iterator it = scope->nestedList.begin(), end = scope->nestedList.end(); it != end; ++it) {
+                    for (std::vector<Scope *>::const_iterator it = scope->nestedList.begin(), end = scope->nestedList.end(); it != end; ++it) {
                         enumerator = (*it)->findEnumerator(tokStr);
 
                         if (enumerator)
@@ -3736,7 +3784,7 @@ const Enumerator * SymbolDatabase::findEnumerator(const Token * tok) const
         if (enumerator)
             return enumerator;
 
-        for (std::list<Scope *>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
+        for (std::vector<Scope *>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
             enumerator = (*s)->findEnumerator(tokStr);
 
             if (enumerator)
@@ -3767,7 +3815,7 @@ const Enumerator * SymbolDatabase::findEnumerator(const Token * tok) const
             if (enumerator)
                 return enumerator;
 
-            for (std::list<Scope*>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
+            for (std::vector<Scope *>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
                 enumerator = (*s)->findEnumerator(tokStr);
 
                 if (enumerator)
@@ -3921,7 +3969,7 @@ const Type* SymbolDatabase::findVariableType(const Scope *start, const Token *ty
 
 bool Scope::hasInlineOrLambdaFunction() const
 {
-    for (std::list<Scope*>::const_iterator it = nestedList.begin(); it != nestedList.end(); ++it) {
+    for (std::vector<Scope *>::const_iterator it = nestedList.begin(); it != nestedList.end(); ++it) {
         const Scope *s = *it;
         // Inline function
         if (s->type == Scope::eUnconditional && Token::simpleMatch(s->bodyStart->previous(), ") {"))
@@ -4425,18 +4473,30 @@ const Function* SymbolDatabase::findFunction(const Token *tok) const
 
 const Scope *SymbolDatabase::findScopeByName(const std::string& name) const
 {
-    for (std::list<Scope>::const_iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
-        if (it->className == name)
-            return &*it;
-    }
+    const std::unordered_map<std::string, std::vector<IndexedScope> >::const_iterator it = mScopesByName.find(name);
+    if (it != mScopesByName.end())
+        return it->second.front().scope;
     return nullptr;
 }
 
+void SymbolDatabase::indexScopes()
+{
+    ChunkedList<Scope>::iterator it = mScopesIndexed ? std::next(mLastIndexedScope) : scopeList.begin();
+    for (; it != scopeList.end(); ++it) {
+        Scope *scope = &*it;
+        // unnamed if/for/while/.. scopes are never looked up by name
+        if (!scope->className.empty() || !scope->isExecutable())
+            mScopesByName[scope->className].emplace_back(mScopesIndexed, scope);
+        ++mScopesIndexed;
+        mLastIndexedScope = it;
+    }
+}
+
 //---------------------------------------------------------------------------
 
 Scope *Scope::findInNestedList(const std::string & name)
 {
-    std::list<Scope *>::iterator it;
+    std::vector<Scope *>::iterator it;
 
     for (it = nestedList.begin(); it != nestedList.end(); ++it) {
         if ((*it)->className == name)
@@ -4449,12 +4509,9 @@ Scope *Scope::findInNestedList(const std::string & name)
 
 const Scope *Scope::findRecordInNestedList(const std::string & name) const
 {
-    std::list<Scope *>::const_iterator it;
-
-    for (it = nestedList.begin(); it != nestedList.end(); ++it) {
-        if ((*it)->className == name && (*it)->type != eFunction)
-            return (*it);
-    }
+    const std::unordered_map<std::string, Scope *>::const_iterator it = nestedRecordMap.find(name);
+    if (it != nestedRecordMap.end())
+        return it->second;
 
     const Type * nested_type = findType(name);
 
@@ -4494,7 +4551,7 @@ const Type* Scope::findType(const std::string & name) const
 
 Scope *Scope::findInNestedListRecursive(const std::string & name)
 {
-    std::list<Scope *>::iterator it;
+    std::vector<Scope *>::iterator it;
 
     for (it = nestedList.begin(); it != nestedList.end(); ++it) {
         if ((*it)->className == name)
@@ -4513,7 +4570,7 @@ Scope *Scope::findInNestedListRecursive(const std::string & name)
 
 const Function *Scope::getDestructor() const
 {
-    std::list<Function>::const_iterator it;
+    ChunkedList<Function>::const_iterator it;
     for (it = functionList.begin(); it != functionList.end(); ++it) {
         if (it->type == Function::eDestructor)
             return &(*it);
@@ -4938,7 +4995,7 @@ void SymbolDatabase::setValueType(Token *tok, const ValueType &valuetype)
             const Scope *typeScope = vt1->typeScope;
             if (!typeScope)
                 return;
-            for (std::list<Variable>::const_iterator it = typeScope->varlist.begin(); it != typeScope->varlist.end(); ++it) {
+            for (ChunkedList<Variable>::const_iterator it = typeScope->varlist.begin(); it != typeScope->varlist.end(); ++it) {
                 if (it->nameToken()->str() == name) {
                     var = &*it;
                     break;
@@ -5241,6 +5298,18 @@ static const Function *getOperatorFunction(const Token * const tok)
     return nullptr;
 }
 
+const ControlFlowGraph *SymbolDatabase::getControlFlowGraph(const Scope *scope) const
+{
+    std::lock_guard<std::mutex> lock(mControlFlowGraphsMutex);
+    std::map<const Scope *, ControlFlowGraph>::const_iterator it = mControlFlowGraphs.find(scope);
+    if (it == mControlFlowGraphs.end()) {
+        if (!scope || scope->type != Scope::eFunction || !scope->bodyStart || !scope->bodyEnd)
+            return nullptr;
+        it = mControlFlowGraphs.insert(std::make_pair(scope, ControlFlowGraph(scope, &mSettings->library))).first;
+    }
+    return &it->second;
+}
+
 void SymbolDatabase::setValueTypeInTokenList()
 {
     Token * tokens = const_cast<Tokenizer *>(mTokenizer)->list.front();
@@ -5248,7 +5317,55 @@ void SymbolDatabase::setValueTypeInTokenList()
     for (Token *tok = tokens; tok; tok = tok->next())
         tok->setValueType(nullptr);
 
-    for (Token *tok = tokens; tok; tok = tok->next()) {
+    // The bodies of the functions that are not nested in other functions
+    // don't depend on each other. The code outside them is handled
+    // first and then the bodies are handled on the thread pool.
+    std::vector<const Scope *> bodies;
+    for (const Scope *scope : functionScopes) {
+        bool nested = false;
+        for (const Scope *s = scope->nestedIn; s && !nested; s = s->nestedIn)
+            nested = s->isExecutable();
+        if (!nested)
+            bodies.push_back(scope);
+    }
+
+    // the bodies must be in token order
+    std::size_t found = 0;
+    for (const Token *tok = tokens; tok && found < bodies.size(); tok = tok->next()) {
+        if (tok == bodies[found]->bodyStart)
+            tok = bodies[found++]->bodyEnd;
+    }
+    if (found < bodies.size()) {
+        setValueTypeInRange(tokens, nullptr);
+    } else {
+        Token *outside = tokens;
+        for (const Scope *scope : bodies) {
+            setValueTypeInRange(outside, scope->bodyStart);
+            outside = scope->bodyEnd->next();
+        }
+        setValueTypeInRange(outside, nullptr);
+
+        std::vector<TaskPool::Task> tasks;
+        for (const Scope *scope : bodies) {
+            Token *start = const_cast<Token *>(scope->bodyStart);
+            const Token *end = scope->bodyEnd->next();
+            tasks.push_back([=]() {
+                setValueTypeInRange(start, end);
+            });
+        }
+        TaskPool::run(mSettings->threads, tasks);
+    }
+
+    // Update functions with new type information.
+    createSymbolDatabaseSetFunctionPointers(false);
+
+    // Update auto variables with new type information.
+    createSymbolDatabaseSetVariablePointers();
+}
+
+void SymbolDatabase::setValueTypeInRange(Token *start, const Token *end)
+{
+    for (Token *tok = start; tok != end; tok = tok->next()) {
         if (tok->isNumber()) {
             if (MathLib::isFloat(tok->str())) {
                 ValueType::Type type = ValueType::Type::DOUBLE;
@@ -5437,12 +5554,6 @@ void SymbolDatabase::setValueTypeInTokenList()
             setValueType(tok, vt);
         }
     }
-
-    // Update functions with new type information.
-    createSymbolDatabaseSetFunctionPointers(false);
-
-    // Update auto variables with new type information.
-    createSymbolDatabaseSetVariablePointers();
 }
 
 ValueType ValueType::parseDecl(const Token *type, const Settings *settings)
@@ -21,7 +21,9 @@
 #define symboldatabaseH
 //---------------------------------------------------------------------------
 
+#include "chunkedlist.h"
 #include "config.h"
+#include "controlflow.h"
 #include "library.h"
 #include "mathlib.h"
 #include "token.h"
@@ -29,8 +31,10 @@
 #include <cstddef>
 #include <list>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -828,7 +832,7 @@ public:
     const ::Type *retType;            ///< function return type
     const Scope *functionScope;       ///< scope of function body
     const Scope* nestedIn;            ///< Scope the function is declared in
-    std::list<Variable> argumentList; ///< argument list
+    ChunkedList<Variable> argumentList; ///< argument list
     unsigned int initArgCount;        ///< number of args with default values
     Type type;                        ///< constructor, destructor, ...
     AccessControl access;             ///< public/protected/private
@@ -925,11 +929,11 @@ public:
     const Token *classDef;   ///< class/struct/union/namespace token
     const Token *bodyStart;  ///< '{' token
     const Token *bodyEnd;    ///< '}' token
-    std::list<Function> functionList;
+    ChunkedList<Function> functionList;
     std::multimap<std::string, const Function *> functionMap;
-    std::list<Variable> varlist;
+    ChunkedList<Variable> varlist;
     const Scope *nestedIn;
-    std::list<Scope *> nestedList;
+    std::vector<Scope *> nestedList;
     unsigned int numConstructors;
     unsigned int numCopyOrMoveConstructors;
     std::list<UsingInfo> usingList;
@@ -937,6 +941,9 @@ public:
     Type* definedType;
     std::map<std::string, Type*> definedTypesMap;
 
+    /** first nested scope with a given name that is not a function */
+    std::unordered_map<std::string, Scope *> nestedRecordMap;
+
     // function specific fields
     const Scope *functionOf; ///< scope this function belongs to
     Function *function; ///< function info for this function
@@ -1020,6 +1027,12 @@ public:
 
     const Function *getDestructor() const;
 
+    void addNestedScope(Scope *scope) {
+        nestedList.push_back(scope);
+        if (scope->type != eFunction)
+            nestedRecordMap.emplace(scope->className, scope);
+    }
+
     void addFunction(const Function & func) {
         functionList.push_back(func);
 
@@ -1114,7 +1127,7 @@ public:
     ~SymbolDatabase();
 
     /** @brief Information about all namespaces/classes/structrues */
-    std::list<Scope> scopeList;
+    ChunkedList<Scope> scopeList;
 
     /** @brief Fast access to function scopes */
     std::vector<const Scope *> functionScopes;
@@ -1123,7 +1136,7 @@ public:
     std::vector<const Scope *> classAndStructScopes;
 
     /** @brief Fast access to types */
-    std::list<Type> typeList;
+    ChunkedList<Type> typeList;
 
     /**
      * @brief find a variable type if it's a user defined type
@@ -1185,6 +1198,9 @@ public:
     /** Set valuetype in provided tokenlist */
     void setValueTypeInTokenList();
 
+    /** Get the control flow graph of a function scope, NULL if it is not a function scope. The graph is created on first use, this is thread safe. */
+    const ControlFlowGraph *getControlFlowGraph(const Scope *scope) const;
+
     /**
      * Calculates sizeof value for given type.
      * @param type Token which will contain e.g. "int", "*", or string.
@@ -1213,6 +1229,9 @@ private:
     void createSymbolDatabaseEnums();
     void createSymbolDatabaseUnknownArrayDimensions();
 
+    /** Add the scopes that were created since the last call to mScopesByName */
+    void indexScopes();
+
     void addClassFunction(Scope **scope, const Token **tok, const Token *argStart);
     Function *addGlobalFunctionDecl(Scope*& scope, const Token* tok, const Token *argStart, const Token* funcStart);
     Function *addGlobalFunction(Scope*& scope, const Token*& tok, const Token *argStart, const Token* funcStart);
@@ -1233,6 +1252,9 @@ private:
 
     const Enumerator * findEnumerator(const Token * tok) const;
 
+    /** Set the value types of the tokens "start .. end". end is not included. */
+    void setValueTypeInRange(Token *start, const Token *end);
+
     void setValueType(Token *tok, const ValueType &valuetype);
     void setValueType(Token *tok, const Variable &var);
     void setValueType(Token *tok, const Enumerator &enumerator);
@@ -1245,11 +1267,28 @@ private:
     std::vector<const Variable *> mVariableList;
 
     /** list for missing types */
-    std::list<Type> mBlankTypes;
+    ChunkedList<Type> mBlankTypes;
+
+    /** control flow graphs of the function scopes, created when they are used */
+    mutable std::map<const Scope *, ControlFlowGraph> mControlFlowGraphs;
+
+    /** checks can run concurrently, guards mControlFlowGraphs */
+    mutable std::mutex mControlFlowGraphsMutex;
 
     bool mIsCpp;
     ValueType::Sign mDefaultSignedness;
 
+    struct IndexedScope {
+        IndexedScope(std::size_t index_, Scope *scope_) : index(index_), scope(scope_) {}
+        std::size_t index;  ///< position in scopeList
+        Scope *scope;
+    };
+
+    /** named scopes and unnamed non-executable scopes by name, in scopeList order */
+    std::unordered_map<std::string, std::vector<IndexedScope> > mScopesByName;
+    std::size_t mScopesIndexed;
+    ChunkedList<Scope>::iterator mLastIndexedScope;
+
     /** "negative cache" list of tokens that we find are not enumeration values */
     mutable std::set<std::string> mTokensThatAreNotEnumeratorValues;
 };
@@ -0,0 +1,57 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "taskpool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+
+void TaskPool::run(unsigned int threads, const std::vector<Task> &tasks)
+{
+    if (threads <= 1 || tasks.size() <= 1) {
+        for (const Task &task : tasks)
+            task();
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(tasks.size());
+    std::atomic<std::size_t> next(0);
+    const auto worker = [&]() {
+        for (std::size_t i = next++; i < tasks.size(); i = next++) {
+            try {
+                tasks[i]();
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < threads && i < tasks.size(); ++i)
+        workers.emplace_back(worker);
+    worker();
+    for (std::thread &t : workers)
+        t.join();
+
+    for (const std::exception_ptr &e : exceptions) {
+        if (e)
+            std::rethrow_exception(e);
+    }
+}
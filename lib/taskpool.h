@@ -0,0 +1,53 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef taskpoolH
+#define taskpoolH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <functional>
+#include <vector>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Run independent tasks on a number of threads.
+ *
+ * The tasks are started in the order they are given. If tasks throw,
+ * all tasks are still run and then the exception of the first failing
+ * task is rethrown, so the result does not depend on the scheduling.
+ */
+class CPPCHECKLIB TaskPool {
+public:
+    typedef std::function<void()> Task;
+
+    /**
+     * Run the tasks and wait until all of them are finished.
+     * @param threads max number of threads. 0 or 1 runs the tasks in the calling thread.
+     * @param tasks tasks to run
+     */
+    static void run(unsigned int threads, const std::vector<Task> &tasks);
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // taskpoolH
@@ -24,6 +24,7 @@
 #include "symboldatabase.h"
 #include "utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstring>
@@ -33,7 +34,7 @@
 #include <stack>
 #include <utility>
 
-const std::list<ValueFlow::Value> Token::mEmptyValueList;
+const std::vector<ValueFlow::Value> Token::mEmptyValueList;
 
 Token::Token(TokensFrontBack *tokensFrontBack) :
     mTokensFrontBack(tokensFrontBack),
@@ -54,6 +55,7 @@ Token::Token(TokensFrontBack *tokensFrontBack) :
     mAstOperand2(nullptr),
     mAstParent(nullptr),
     mOriginalName(nullptr),
+    mLibraryFunction(nullptr),
     mValueType(nullptr),
     mValues(nullptr)
 {
@@ -82,6 +84,7 @@ static const std::set<std::string> controlFlowKeywords = {
 
 void Token::update_property_info()
 {
+    mLibraryFunction = nullptr;
     setFlag(fIsControlFlowKeyword, controlFlowKeywords.find(mStr) != controlFlowKeywords.end());
 
     if (!mStr.empty()) {
@@ -277,6 +280,7 @@ void Token::takeData(Token *fromToken)
     mLink = fromToken->mLink;
     mScope = fromToken->mScope;
     mFunction = fromToken->mFunction;
+    mLibraryFunction = fromToken->mLibraryFunction;
     if (fromToken->mOriginalName) {
         delete mOriginalName;
         mOriginalName = fromToken->mOriginalName;
@@ -1455,7 +1459,7 @@ const ValueFlow::Value * Token::getValueLE(const MathLib::bigint val, const Sett
     if (!mValues)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = mValues->begin(); it != mValues->end(); ++it) {
         if (it->isIntValue() && it->intvalue <= val) {
             if (!ret || ret->isInconclusive() || (ret->condition && !it->isInconclusive()))
@@ -1478,7 +1482,7 @@ const ValueFlow::Value * Token::getValueGE(const MathLib::bigint val, const Sett
     if (!mValues)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = mValues->begin(); it != mValues->end(); ++it) {
         if (it->isIntValue() && it->intvalue >= val) {
             if (!ret || ret->isInconclusive() || (ret->condition && !it->isInconclusive()))
@@ -1501,7 +1505,7 @@ const ValueFlow::Value * Token::getInvalidValue(const Token *ftok, unsigned int
     if (!mValues || !settings)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = mValues->begin(); it != mValues->end(); ++it) {
         if ((it->isIntValue() && !settings->library.isIntArgValid(ftok, argnr, it->intvalue)) ||
             (it->isFloatValue() && !settings->library.isFloatArgValid(ftok, argnr, it->floatValue))) {
@@ -1526,7 +1530,7 @@ const Token *Token::getValueTokenMinStrSize() const
         return nullptr;
     const Token *ret = nullptr;
     std::size_t minsize = ~0U;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = mValues->begin(); it != mValues->end(); ++it) {
         if (it->isTokValue() && it->tokvalue && it->tokvalue->tokType() == Token::eString) {
             const std::size_t size = getStrSize(it->tokvalue);
@@ -1545,7 +1549,7 @@ const Token *Token::getValueTokenMaxStrLength() const
         return nullptr;
     const Token *ret = nullptr;
     std::size_t maxlength = 0U;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = mValues->begin(); it != mValues->end(); ++it) {
         if (it->isTokValue() && it->tokvalue && it->tokvalue->tokType() == Token::eString) {
             const std::size_t length = getStrLength(it->tokvalue);
@@ -1569,7 +1573,7 @@ const Token *Token::getValueTokenDeadPointer() const
 {
     const Scope * const functionscope = getfunctionscope(this->scope());
 
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = values().begin(); it != values().end(); ++it) {
         // Is this a pointer alias?
         if (!it->isTokValue() || (it->tokvalue && it->tokvalue->str() != "&"))
@@ -1598,7 +1602,7 @@ const Token *Token::getValueTokenDeadPointer() const
     return nullptr;
 }
 
-bool Token::addValue(const ValueFlow::Value &value)
+bool Token::addValue(const ValueFlow::Value &value, std::size_t maxValues)
 {
     if (value.isKnown() && mValues) {
         // Clear all other values since value is known
@@ -1606,13 +1610,15 @@ bool Token::addValue(const ValueFlow::Value &value)
     }
 
     if (mValues) {
-        // Don't handle more than 10 values for performance reasons
-        // TODO: add setting?
-        if (mValues->size() >= 10U)
+        // Don't handle more than maxValues values for performance reasons
+        if (mValues->size() >= maxValues) {
+            // Drop the value, replacing a value could lose the value that a check depends on
+            isValueBudgetExceeded(true);
             return false;
+        }
 
         // if value already exists, don't add it again
-        std::list<ValueFlow::Value>::iterator it;
+        std::vector<ValueFlow::Value>::iterator it;
         for (it = mValues->begin(); it != mValues->end(); ++it) {
             // different intvalue => continue
             if (it->intvalue != value.intvalue)
@@ -1647,7 +1653,7 @@ bool Token::addValue(const ValueFlow::Value &value)
         ValueFlow::Value v(value);
         if (v.varId == 0)
             v.varId = mVarId;
-        mValues = new std::list<ValueFlow::Value>(1, v);
+        mValues = new std::vector<ValueFlow::Value>(1, v);
     }
 
     return true;
@@ -33,6 +33,7 @@
 
 class Enumerator;
 class Function;
+class Library;
 class Scope;
 class Settings;
 class Type;
@@ -47,6 +48,15 @@ struct TokensFrontBack {
     Token *back;
 };
 
+/**
+ * @brief Library function name of a call, resolved once by the tokenizer.
+ */
+struct LibraryFunctionName {
+    LibraryFunctionName(const Library *library_, const std::string &name_) : library(library_), name(name_) {}
+    const Library *library;
+    std::string name;
+};
+
 /// @addtogroup Core
 /// @{
 
@@ -425,6 +435,13 @@ public:
     void isAttributeNodiscard(const bool value) {
         setFlag(fIsAttributeNodiscard, value);
     }
+    /** Did the token get more ValueFlow values than the value budget allows? */
+    bool isValueBudgetExceeded() const {
+        return getFlag(fIsValueBudgetExceeded);
+    }
+    void isValueBudgetExceeded(const bool value) {
+        setFlag(fIsValueBudgetExceeded, value);
+    }
     bool isControlFlowKeyword() const {
         return getFlag(fIsControlFlowKeyword);
     }
@@ -696,6 +713,31 @@ public:
         return mTokType == eFunction ? mFunction : nullptr;
     }
 
+    /**
+     * Remember the library function name of a call, see
+     * Tokenizer::resolveLibraryFunctions(). It is forgotten when the
+     * token string changes.
+     * @param f library function name, owned by the tokenizer
+     * @param notLibraryFunction result of Library::isNotLibraryFunction()
+     */
+    void libraryFunction(const LibraryFunctionName *f, bool notLibraryFunction) {
+        mLibraryFunction = f;
+        setFlag(fIsNotLibraryFunction, notLibraryFunction);
+    }
+
+    /**
+     * @return the library function name of a call or nullptr if it has
+     * not been resolved.
+     */
+    const LibraryFunctionName *libraryFunction() const {
+        return mLibraryFunction;
+    }
+
+    /** Cached Library::isNotLibraryFunction(), only valid if libraryFunction() is set */
+    bool isNotLibraryFunction() const {
+        return getFlag(fIsNotLibraryFunction);
+    }
+
     /**
      * Associate this token with given variable
      * @param v Variable to be associated
@@ -813,7 +855,7 @@ public:
         return mOriginalName ? *mOriginalName : emptyString;
     }
 
-    const std::list<ValueFlow::Value>& values() const {
+    const std::vector<ValueFlow::Value>& values() const {
         return mValues ? *mValues : mEmptyValueList;
     }
 
@@ -890,8 +932,11 @@ public:
 
     const Token *getValueTokenDeadPointer() const;
 
-    /** Add token value. Return true if value is added. */
-    bool addValue(const ValueFlow::Value &value);
+    /**
+     * Add token value. Return true if value is added.
+     * When the token already has maxValues values the new value is dropped.
+     */
+    bool addValue(const ValueFlow::Value &value, std::size_t maxValues = ValueFlow::DEFAULT_MAX_VALUES);
 
 private:
 
@@ -972,6 +1017,8 @@ private:
         fIsLiteral              = (1 << 21),
         fIsTemplateArg          = (1 << 22),
         fIsAttributeNodiscard   = (1 << 23), // __attribute__ ((warn_unused_result)), [[nodiscard]]
+        fIsValueBudgetExceeded  = (1 << 24), // Values were dropped in addValue()
+        fIsNotLibraryFunction   = (1 << 25), // see libraryFunction()
     };
 
     unsigned int mFlags;
@@ -1012,12 +1059,15 @@ private:
     // original name like size_t
     std::string* mOriginalName;
 
+    // library function name of a call
+    const LibraryFunctionName *mLibraryFunction;
+
     // ValueType
     ValueType *mValueType;
 
     // ValueFlow
-    std::list<ValueFlow::Value>* mValues;
-    static const std::list<ValueFlow::Value> mEmptyValueList;
+    std::vector<ValueFlow::Value>* mValues;
+    static const std::vector<ValueFlow::Value> mEmptyValueList;
 
 public:
     void astOperand1(Token *tok);
@@ -1747,6 +1747,7 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration)
     if (!simplifyTokenList1(list.getFiles().front().c_str()))
         return false;
 
+    list.summarizeNames();
     list.createAst();
     list.validateAst();
 
@@ -1765,6 +1766,7 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration)
     }
 
     mSymbolDatabase->setValueTypeInTokenList();
+    resolveLibraryFunctions();
     ValueFlow::setValues(&list, mSymbolDatabase, mErrorLogger, mSettings);
 
     printDebugOutput(1);
@@ -1994,26 +1996,27 @@ void Tokenizer::simplifySQL()
     }
 }
 
-void Tokenizer::simplifyArrayAccessSyntax()
+bool Tokenizer::peepholeArrayAccessSyntax(Token *tok)
 {
     // 0[a] -> a[0]
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->isNumber() && Token::Match(tok, "%num% [ %name% ]")) {
-            const std::string number(tok->str());
-            Token* indexTok = tok->tokAt(2);
-            tok->str(indexTok->str());
-            tok->varId(indexTok->varId());
-            indexTok->str(number);
-        }
+    if (tok->isNumber() && Token::Match(tok, "%num% [ %name% ]")) {
+        const std::string number(tok->str());
+        Token* indexTok = tok->tokAt(2);
+        tok->str(indexTok->str());
+        tok->varId(indexTok->varId());
+        indexTok->str(number);
+        return true;
     }
+    return false;
 }
 
-void Tokenizer::simplifyParameterVoid()
+bool Tokenizer::peepholeParameterVoid(Token *tok)
 {
-    for (Token* tok = list.front(); tok; tok = tok->next()) {
-        if (Token::Match(tok, "%name% ( void )"))
-            tok->next()->deleteNext();
+    if (Token::Match(tok, "%name% ( void )")) {
+        tok->next()->deleteNext();
+        return true;
     }
+    return false;
 }
 
 void Tokenizer::simplifyRedundantConsecutiveBraces()
@@ -2031,44 +2034,25 @@ void Tokenizer::simplifyRedundantConsecutiveBraces()
     }
 }
 
-void Tokenizer::simplifyDoublePlusAndDoubleMinus()
+bool Tokenizer::peepholeDoublePlusAndDoubleMinus(Token *tok)
 {
     // Convert - - into + and + - into -
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        while (tok->next()) {
-            if (tok->str() == "+") {
-                if (tok->next()->str()[0] == '-') {
-                    tok = tok->next();
-                    if (tok->str().size() == 1) {
-                        tok = tok->previous();
-                        tok->str("-");
-                        tok->deleteNext();
-                    } else if (tok->isNumber()) {
-                        tok->str(tok->str().substr(1));
-                        tok = tok->previous();
-                        tok->str("-");
-                    }
-                    continue;
-                }
-            } else if (tok->str() == "-") {
-                if (tok->next()->str()[0] == '-') {
-                    tok = tok->next();
-                    if (tok->str().size() == 1) {
-                        tok = tok->previous();
-                        tok->str("+");
-                        tok->deleteNext();
-                    } else if (tok->isNumber()) {
-                        tok->str(tok->str().substr(1));
-                        tok = tok->previous();
-                        tok->str("+");
-                    }
-                    continue;
-                }
-            }
-
+    bool rewritten = false;
+    while (tok->next() && (tok->str() == "+" || tok->str() == "-") && tok->next()->str()[0] == '-') {
+        Token * const next = tok->next();
+        const char * const sign = (tok->str() == "+") ? "-" : "+";
+        if (next->str().size() == 1) {
+            tok->str(sign);
+            tok->deleteNext();
+        } else if (next->isNumber()) {
+            next->str(next->str().substr(1));
+            tok->str(sign);
+        } else {
             break;
         }
+        rewritten = true;
     }
+    return rewritten;
 }
 
 /** Specify array size if it hasn't been given */
@@ -3681,11 +3665,14 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (mSettings->terminated())
         return false;
 
-    // remove calling conventions __cdecl, __stdcall..
-    simplifyCallingConvention();
-
-    // Remove __declspec()
-    simplifyDeclspec();
+    // remove calling conventions __cdecl, __stdcall.. and __declspec()
+    {
+        static const PeepholeRule rules[] = {
+            &Tokenizer::peepholeCallingConvention,
+            &Tokenizer::peepholeDeclspec
+        };
+        runPeepholeRules(rules, sizeof(rules) / sizeof(rules[0]));
+    }
     validate();
     // remove some unhandled macros in global scope
     removeMacrosInGlobalScope();
@@ -3701,11 +3688,14 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     // remove unnecessary member qualification..
     removeUnnecessaryQualification();
 
-    // convert Microsoft memory functions
-    simplifyMicrosoftMemoryFunctions();
-
-    // convert Microsoft string functions
-    simplifyMicrosoftStringFunctions();
+    // convert Microsoft memory and string functions
+    if (mSettings->isWindowsPlatform()) {
+        static const PeepholeRule rules[] = {
+            &Tokenizer::peepholeMicrosoftMemoryFunction,
+            &Tokenizer::peepholeMicrosoftStringFunction
+        };
+        runPeepholeRules(rules, sizeof(rules) / sizeof(rules[0]));
+    }
 
     if (mSettings->terminated())
         return false;
@@ -3873,38 +3863,82 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     // Convert e.g. atol("0") into 0
     simplifyMathFunctions();
 
-    simplifyDoublePlusAndDoubleMinus();
-
-    simplifyArrayAccessSyntax();
+    // Local rewrites that do not interact with the passes below
+    {
+        static const PeepholeRule rules[] = {
+            &Tokenizer::peepholeDoublePlusAndDoubleMinus,
+            &Tokenizer::peepholeArrayAccessSyntax,
+            &Tokenizer::peepholeParameterVoid,
+            &Tokenizer::peepholeNamelessRValueReference
+        };
+        runPeepholeRules(rules, sizeof(rules) / sizeof(rules[0]));
+    }
 
     Token::assignProgressValues(list.front());
 
     removeRedundantSemicolons();
 
-    simplifyParameterVoid();
-
     simplifyRedundantConsecutiveBraces();
 
     simplifyEmptyNamespaces();
 
     elseif();
 
-    SimplifyNamelessRValueReferences();
-
-
     validate();
     return true;
 }
 
+void Tokenizer::runPeepholeRules(const PeepholeRule rules[], std::size_t count)
+{
+    if (!list.front())
+        return;
+
+    // --debug-peephole: run the rules as separate passes on a copy of the token list
+    TokenList reference(mSettings);
+    if (mSettings->debugPeephole) {
+        reference.addtoken(";", 0U, 0U);
+        TokenList::copyTokens(reference.front(), list.front(), list.back());
+        reference.front()->deleteThis();
+        for (std::size_t i = 0; i < count; ++i) {
+            for (Token *tok = reference.front(); tok; tok = tok->next())
+                (this->*rules[i])(tok);
+        }
+    }
+
+    for (Token *tok = list.front(); tok; tok = tok->next()) {
+        // a rewrite might create a window that another rule handles
+        bool rewritten = true;
+        while (rewritten) {
+            rewritten = false;
+            for (std::size_t i = 0; i < count; ++i) {
+                if ((this->*rules[i])(tok))
+                    rewritten = true;
+            }
+        }
+    }
+
+    if (mSettings->debugPeephole) {
+        const Token *tok1 = list.front();
+        const Token *tok2 = reference.front();
+        while (tok1 && tok2 && tok1->str() == tok2->str() && tok1->varId() == tok2->varId()) {
+            tok1 = tok1->next();
+            tok2 = tok2->next();
+        }
+        if (tok1 || tok2)
+            throw InternalError(tok1 ? tok1 : list.back(), "Internal Error: Fused peephole simplification differs from separate passes");
+    }
+}
+
 bool Tokenizer::simplifyTokenList2()
 {
     // clear the _functionList so it can't contain dead pointers
     deleteSymbolDatabase();
 
-    // Clear AST,ValueFlow. These will be created again at the end of this function.
+    // Clear AST,ValueFlow,library functions. These will be created again at the end of this function.
     for (Token *tok = list.front(); tok; tok = tok->next()) {
         tok->clearAst();
         tok->clearValueFlow();
+        tok->libraryFunction(nullptr, false);
     }
 
     // f(x=g())   =>   x=g(); f(x)
@@ -4030,6 +4064,7 @@ bool Tokenizer::simplifyTokenList2()
     // Create symbol database and then remove const keywords
     createSymbolDatabase();
     mSymbolDatabase->setValueTypeInTokenList();
+    resolveLibraryFunctions();
 
     ValueFlow::setValues(&list, mSymbolDatabase, mErrorLogger, mSettings);
 
@@ -4064,6 +4099,14 @@ void Tokenizer::printDebugOutput(unsigned int simplification) const
         if (mSettings->verbose)
             list.front()->printAst(mSettings->verbose, mSettings->xml, std::cout);
 
+        if (mSymbolDatabase && mSettings->verbose && !mSettings->xml) {
+            for (const Scope *scope : mSymbolDatabase->functionScopes) {
+                const ControlFlowGraph *cfg = mSymbolDatabase->getControlFlowGraph(scope);
+                if (cfg)
+                    std::cout << "##Control flow graph " << scope->className << std::endl << cfg->str();
+            }
+        }
+
         list.front()->printValueFlow(mSettings->xml, std::cout);
 
         if (mSettings->xml)
@@ -7580,7 +7623,7 @@ void Tokenizer::simplifyStd()
 bool Tokenizer::IsScopeNoReturn(const Token *endScopeToken, bool *unknown) const
 {
     std::string unknownFunc;
-    const bool ret = mSettings->library.isScopeNoReturn(endScopeToken,&unknownFunc);
+    const bool ret = mSettings->summaries.isScopeNoReturn(endScopeToken, mSettings->library, &unknownFunc);
     if (unknown)
         *unknown = !unknownFunc.empty();
     if (!unknownFunc.empty() && mSettings->checkLibrary && mSettings->isEnabled(Settings::INFORMATION)) {
@@ -8855,39 +8898,41 @@ void Tokenizer::simplifyStructDecl()
     }
 }
 
-void Tokenizer::simplifyCallingConvention()
+bool Tokenizer::peepholeCallingConvention(Token *tok)
 {
     const bool windows = mSettings->isWindowsPlatform();
 
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        while (Token::Match(tok, "__cdecl|__stdcall|__fastcall|__thiscall|__clrcall|__syscall|__pascal|__fortran|__far|__near") || (windows && Token::Match(tok, "WINAPI|APIENTRY|CALLBACK"))) {
-            tok->deleteThis();
-        }
+    bool rewritten = false;
+    while (Token::Match(tok, "__cdecl|__stdcall|__fastcall|__thiscall|__clrcall|__syscall|__pascal|__fortran|__far|__near") || (windows && Token::Match(tok, "WINAPI|APIENTRY|CALLBACK"))) {
+        tok->deleteThis();
+        rewritten = true;
     }
+    return rewritten;
 }
 
-void Tokenizer::simplifyDeclspec()
+bool Tokenizer::peepholeDeclspec(Token *tok)
 {
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        while (Token::Match(tok, "__declspec|_declspec (") && tok->next()->link() && tok->next()->link()->next()) {
-            if (Token::Match(tok->tokAt(2), "noreturn|nothrow")) {
-                Token *tok1 = tok->next()->link()->next();
-                while (tok1 && !Token::Match(tok1, "%name%")) {
-                    tok1 = tok1->next();
-                }
-                if (tok1) {
-                    if (tok->strAt(2) == "noreturn")
-                        tok1->isAttributeNoreturn(true);
-                    else
-                        tok1->isAttributeNothrow(true);
-                }
-            } else if (tok->strAt(2) == "property")
-                tok->next()->link()->insertToken("__property");
+    bool rewritten = false;
+    while (Token::Match(tok, "__declspec|_declspec (") && tok->next()->link() && tok->next()->link()->next()) {
+        if (Token::Match(tok->tokAt(2), "noreturn|nothrow")) {
+            Token *tok1 = tok->next()->link()->next();
+            while (tok1 && !Token::Match(tok1, "%name%")) {
+                tok1 = tok1->next();
+            }
+            if (tok1) {
+                if (tok->strAt(2) == "noreturn")
+                    tok1->isAttributeNoreturn(true);
+                else
+                    tok1->isAttributeNothrow(true);
+            }
+        } else if (tok->strAt(2) == "property")
+            tok->next()->link()->insertToken("__property");
 
-            Token::eraseTokens(tok, tok->next()->link()->next());
-            tok->deleteThis();
-        }
+        Token::eraseTokens(tok, tok->next()->link()->next());
+        tok->deleteThis();
+        rewritten = true;
     }
+    return rewritten;
 }
 
 void Tokenizer::simplifyAttribute()
@@ -9473,57 +9518,54 @@ void Tokenizer::simplifyNamespaceStd()
 }
 
 
-void Tokenizer::simplifyMicrosoftMemoryFunctions()
+bool Tokenizer::peepholeMicrosoftMemoryFunction(Token *tok)
 {
-    // skip if not Windows
-    if (!mSettings->isWindowsPlatform())
-        return;
+    if (tok->strAt(1) != "(")
+        return false;
 
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->strAt(1) != "(")
-            continue;
+    if (Token::Match(tok, "CopyMemory|RtlCopyMemory|RtlCopyBytes")) {
+        tok->str("memcpy");
+    } else if (Token::Match(tok, "MoveMemory|RtlMoveMemory")) {
+        tok->str("memmove");
+    } else if (Token::Match(tok, "FillMemory|RtlFillMemory|RtlFillBytes")) {
+        // FillMemory(dst, len, val) -> memset(dst, val, len)
+        tok->str("memset");
 
-        if (Token::Match(tok, "CopyMemory|RtlCopyMemory|RtlCopyBytes")) {
-            tok->str("memcpy");
-        } else if (Token::Match(tok, "MoveMemory|RtlMoveMemory")) {
-            tok->str("memmove");
-        } else if (Token::Match(tok, "FillMemory|RtlFillMemory|RtlFillBytes")) {
-            // FillMemory(dst, len, val) -> memset(dst, val, len)
-            tok->str("memset");
-
-            Token *tok1 = tok->tokAt(2);
-            if (tok1)
-                tok1 = tok1->nextArgument(); // Second argument
-            if (tok1) {
-                Token *tok2 = tok1->nextArgument(); // Third argument
+        Token *tok1 = tok->tokAt(2);
+        if (tok1)
+            tok1 = tok1->nextArgument(); // Second argument
+        if (tok1) {
+            Token *tok2 = tok1->nextArgument(); // Third argument
 
-                if (tok2)
-                    Token::move(tok1->previous(), tok2->tokAt(-2), tok->next()->link()->previous()); // Swap third with second argument
-            }
-        } else if (Token::Match(tok, "ZeroMemory|RtlZeroMemory|RtlZeroBytes|RtlSecureZeroMemory")) {
-            // ZeroMemory(dst, len) -> memset(dst, 0, len)
-            tok->str("memset");
+            if (tok2)
+                Token::move(tok1->previous(), tok2->tokAt(-2), tok->next()->link()->previous()); // Swap third with second argument
+        }
+    } else if (Token::Match(tok, "ZeroMemory|RtlZeroMemory|RtlZeroBytes|RtlSecureZeroMemory")) {
+        // ZeroMemory(dst, len) -> memset(dst, 0, len)
+        tok->str("memset");
 
-            Token *tok1 = tok->tokAt(2);
-            if (tok1)
-                tok1 = tok1->nextArgument(); // Second argument
+        Token *tok1 = tok->tokAt(2);
+        if (tok1)
+            tok1 = tok1->nextArgument(); // Second argument
 
-            if (tok1) {
-                tok1 = tok1->previous();
-                tok1->insertToken("0");
-                tok1 = tok1->next();
-                tok1->insertToken(",");
-            }
-        } else if (Token::simpleMatch(tok, "RtlCompareMemory")) {
-            // RtlCompareMemory(src1, src2, len) -> memcmp(src1, src2, len)
-            tok->str("memcmp");
-            // For the record, when memcmp returns 0, both strings are equal.
-            // When RtlCompareMemory returns len, both strings are equal.
-            // It might be needed to improve this replacement by something
-            // like ((len - memcmp(src1, src2, len)) % (len + 1)) to
-            // respect execution path (if required)
-        }
+        if (tok1) {
+            tok1 = tok1->previous();
+            tok1->insertToken("0");
+            tok1 = tok1->next();
+            tok1->insertToken(",");
+        }
+    } else if (Token::simpleMatch(tok, "RtlCompareMemory")) {
+        // RtlCompareMemory(src1, src2, len) -> memcmp(src1, src2, len)
+        tok->str("memcmp");
+        // For the record, when memcmp returns 0, both strings are equal.
+        // When RtlCompareMemory returns len, both strings are equal.
+        // It might be needed to improve this replacement by something
+        // like ((len - memcmp(src1, src2, len)) % (len + 1)) to
+        // respect execution path (if required)
+    } else {
+        return false;
     }
+    return true;
 }
 
 namespace {
@@ -9568,36 +9610,33 @@ namespace {
     };
 }
 
-void Tokenizer::simplifyMicrosoftStringFunctions()
+bool Tokenizer::peepholeMicrosoftStringFunction(Token *tok)
 {
-    // skip if not Windows
-    if (!mSettings->isWindowsPlatform())
-        return;
+    if (tok->strAt(1) != "(")
+        return false;
 
     const bool ansi = mSettings->platformType == Settings::Win32A;
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->strAt(1) != "(")
-            continue;
-
-        const std::map<std::string, triplet>::const_iterator match = apis.find(tok->str());
-        if (match!=apis.end()) {
-            tok->str(ansi ? match->second.mbcs : match->second.unicode);
-            tok->originalName(match->first);
-        } else if (Token::Match(tok, "_T|_TEXT|TEXT ( %char%|%str% )")) {
-            tok->deleteNext();
-            tok->deleteThis();
+    const std::map<std::string, triplet>::const_iterator match = apis.find(tok->str());
+    if (match!=apis.end()) {
+        tok->str(ansi ? match->second.mbcs : match->second.unicode);
+        tok->originalName(match->first);
+        return true;
+    } else if (Token::Match(tok, "_T|_TEXT|TEXT ( %char%|%str% )")) {
+        tok->deleteNext();
+        tok->deleteThis();
+        tok->deleteNext();
+        if (!ansi)
+            tok->isLong(true);
+        while (Token::Match(tok->next(), "_T|_TEXT|TEXT ( %char%|%str% )")) {
+            tok->next()->deleteNext();
+            tok->next()->deleteThis();
+            tok->next()->deleteNext();
+            tok->concatStr(tok->next()->str());
             tok->deleteNext();
-            if (!ansi)
-                tok->isLong(true);
-            while (Token::Match(tok->next(), "_T|_TEXT|TEXT ( %char%|%str% )")) {
-                tok->next()->deleteNext();
-                tok->next()->deleteThis();
-                tok->next()->deleteNext();
-                tok->concatStr(tok->next()->str());
-                tok->deleteNext();
-            }
         }
+        return true;
     }
+    return false;
 }
 
 // Remove Borland code
@@ -9718,6 +9757,21 @@ void Tokenizer::deleteSymbolDatabase()
     mSymbolDatabase = nullptr;
 }
 
+void Tokenizer::resolveLibraryFunctions()
+{
+    for (Token *tok = list.front(); tok; tok = tok->next()) {
+        tok->libraryFunction(nullptr, false);
+        if (!tok->isName())
+            continue;
+        const std::string name = mSettings->library.getFunctionName(tok);
+        if (name.empty())
+            continue;
+        const bool notLibraryFunction = mSettings->library.isNotLibraryFunction(tok);
+        const LibraryFunctionName &f = mLibraryFunctions.emplace(name, LibraryFunctionName(&mSettings->library, name)).first->second;
+        tok->libraryFunction(&f, notLibraryFunction);
+    }
+}
+
 static bool operatorEnd(const Token * tok)
 {
     if (tok && tok->str() == ")") {
@@ -10189,15 +10243,15 @@ void Tokenizer::setPodTypes()
     }
 }
 
-void Tokenizer::SimplifyNamelessRValueReferences()
+bool Tokenizer::peepholeNamelessRValueReference(Token *tok)
 {
     // Simplify nameless rValue references - named ones are simplified later
-    for (Token* tok = list.front(); tok; tok = tok->next()) {
-        if (Token::Match(tok, "&& [,)]")) {
-            tok->str("&");
-            tok->insertToken("&");
-        }
+    if (Token::Match(tok, "&& [,)]")) {
+        tok->str("&");
+        tok->insertToken("&");
+        return true;
     }
+    return false;
 }
 
 const Token *Tokenizer::findSQLBlockEnd(const Token *tokSQLStart)
@@ -25,6 +25,7 @@
 #include "errorlogger.h"
 #include "tokenlist.h"
 
+#include <cstddef>
 #include <ctime>
 #include <list>
 #include <map>
@@ -150,8 +151,6 @@ public:
     */
     bool simplifyTokenList1(const char FileName[]);
 
-    void SimplifyNamelessRValueReferences();
-
     /**
     * Most aggressive simplification of tokenlist
     *
@@ -481,14 +480,8 @@ public:
      */
     void simplifyTemplates();
 
-    void simplifyDoublePlusAndDoubleMinus();
-
     void simplifyRedundantConsecutiveBraces();
 
-    void simplifyArrayAccessSyntax();
-
-    void simplifyParameterVoid();
-
     void fillTypeSizes();
 
     void combineOperators();
@@ -623,15 +616,41 @@ private:
     /** Detect garbage expression */
     static bool isGarbageExpr(const Token *start, const Token *end);
 
+    /**
+     * Peephole rewrite rule. A rule inspects and rewrites a bounded token
+     * window that starts at the given token, it never touches tokens before it.
+     * Rules return true if they rewrote something.
+     */
+    typedef bool (Tokenizer::*PeepholeRule)(Token *tok);
+
+    /**
+     * Run several peephole rules in a single traversal of the token list.
+     * With --debug-peephole the result is compared with running the rules
+     * as separate passes, and an InternalError is thrown if they differ.
+     */
+    void runPeepholeRules(const PeepholeRule rules[], std::size_t count);
+
+    /** Convert - - into + and + - into - */
+    bool peepholeDoublePlusAndDoubleMinus(Token *tok);
+
+    /** 0[a] -> a[0] */
+    bool peepholeArrayAccessSyntax(Token *tok);
+
+    /** f(void) -> f() */
+    bool peepholeParameterVoid(Token *tok);
+
+    /** Simplify nameless rvalue references: "&& ," -> "& & ," */
+    bool peepholeNamelessRValueReference(Token *tok);
+
     /**
      * Remove __declspec()
      */
-    void simplifyDeclspec();
+    bool peepholeDeclspec(Token *tok);
 
     /**
      * Remove calling convention
      */
-    void simplifyCallingConvention();
+    bool peepholeCallingConvention(Token *tok);
 
     /**
      * Remove __attribute__ ((?))
@@ -675,13 +694,13 @@ private:
     * MoveMemory(dst, src, len) -> memmove(dst, src, len)
     * ZeroMemory(dst, len) -> memset(dst, 0, len)
     */
-    void simplifyMicrosoftMemoryFunctions();
+    bool peepholeMicrosoftMemoryFunction(Token *tok);
 
     /**
     * Convert Microsoft string functions
     * _tcscpy -> strcpy
     */
-    void simplifyMicrosoftStringFunctions();
+    bool peepholeMicrosoftStringFunction(Token *tok);
 
     /**
       * Remove Borland code
@@ -779,6 +798,12 @@ public:
     void createSymbolDatabase();
     void deleteSymbolDatabase();
 
+    /**
+     * Resolve the library function name of each call once, so
+     * Library lookups don't have to rebuild it for every query.
+     */
+    void resolveLibraryFunctions();
+
     /** print --debug output if debug flags match the simplification:
      * 0=unknown/both simplifications
      * 1=1st simplifications
@@ -881,6 +906,9 @@ private:
     /** sizeof information for known types */
     std::map<std::string, unsigned int> mTypeSize;
 
+    /** library function names that tokens point at, see resolveLibraryFunctions() */
+    std::map<std::string, LibraryFunctionName> mLibraryFunctions;
+
     /** variable count */
     unsigned int mVarId;
 
@@ -26,8 +26,10 @@
 #include "token.h"
 
 #include <simplecpp.h>
+#include <algorithm>
 #include <cctype>
 #include <cstring>
+#include <functional>
 #include <set>
 #include <stack>
 
@@ -746,6 +748,7 @@ static void compilePrecedence3(Token *&tok, AST_state& state)
             compileUnaryOp(tok, state, compilePrecedence3);
         } else if (tok->str() == "(" && iscast(tok)) {
             Token* tok2 = tok;
+            tok2->isCast(true);
             tok = tok->link()->next();
             compilePrecedence3(tok, state);
             compileUnaryOp(tok2, state, nullptr);
@@ -1168,6 +1171,32 @@ void TokenList::createAst()
     }
 }
 
+void TokenList::summarizeNames()
+{
+    std::vector<std::size_t> hashes;
+    for (const Token *tok = mTokensFrontBack.front; tok; tok = tok->next()) {
+        if (tok->isName())
+            hashes.push_back(std::hash<std::string>()(tok->str()));
+    }
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+    // 10 bits per name, about 3% of the names that are not used pass the filter
+    mNames.assign(std::max<std::size_t>(64U, 10U * hashes.size()), false);
+    for (const std::size_t h : hashes) {
+        mNames[h % mNames.size()] = true;
+        mNames[(h / mNames.size()) % mNames.size()] = true;
+    }
+}
+
+bool TokenList::mayContainName(const std::string &name) const
+{
+    if (mNames.empty())
+        return true;
+    const std::size_t h = std::hash<std::string>()(name);
+    return mNames[h % mNames.size()] && mNames[(h / mNames.size()) % mNames.size()];
+}
+
 void TokenList::validateAst() const
 {
     // Check for some known issues in AST to avoid crash/hang later on
@@ -159,6 +159,19 @@ public:
      */
     void validateAst() const;
 
+    /**
+     * Create a summary of the names in the token list. It is used by
+     * mayContainName() to quickly rule out that a name is used.
+     */
+    void summarizeNames();
+
+    /**
+     * Might the given name be used in the token list? If this returns
+     * false the name is not used. Before summarizeNames() is called this
+     * always returns true.
+     */
+    bool mayContainName(const std::string &name) const;
+
     /**
      * Verify that the given token is an element of the tokenlist.
      * That method is implemented for debugging purposes.
@@ -192,6 +205,9 @@ private:
 
     /** File is known to be C/C++ code */
     bool mIsC, mIsCpp;
+
+    /** Bloom filter with the names in the token list, it is sized by the number of names */
+    std::vector<bool> mNames;
 };
 
 /// @}
@@ -84,13 +84,16 @@
 #include "platform.h"
 #include "settings.h"
 #include "standards.h"
+#include "summaries.h"
 #include "symboldatabase.h"
+#include "taskpool.h"
 #include "token.h"
 #include "tokenlist.h"
 #include "utils.h"
 #include "path.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <functional>
 #include <iterator>
@@ -214,15 +217,31 @@ static bool conditionIsTrue(const Token *condition, const ProgramMemory &program
     return !error && result == 1;
 }
 
+/** Is the given variable the only variable that is used in the expression? */
+static bool isOnlyVariableInExpression(const Token *expr, unsigned int varid)
+{
+    if (!expr)
+        return true;
+    if (expr->varId() && expr->varId() != varid)
+        return false;
+    return isOnlyVariableInExpression(expr->astOperand1(), varid) &&
+           isOnlyVariableInExpression(expr->astOperand2(), varid);
+}
+
 /**
  * Get program memory by looking backwards from given token.
+ * The backward walk only adds values for other variables. If the
+ * expression that will be evaluated does not use other variables the
+ * walk is skipped.
  */
-static ProgramMemory getProgramMemory(const Token *tok, unsigned int varid, const ValueFlow::Value &value)
+static ProgramMemory getProgramMemory(const Token *tok, const Token *expr, unsigned int varid, const ValueFlow::Value &value)
 {
     ProgramMemory programMemory;
     programMemory.setValue(varid, value);
     if (value.varId)
         programMemory.setIntValue(value.varId, value.varvalue);
+    if (isOnlyVariableInExpression(expr, varid))
+        return programMemory;
     const ProgramMemory programMemory1(programMemory);
     int indentlevel = 0;
     for (const Token *tok2 = tok; tok2; tok2 = tok2->previous()) {
@@ -345,10 +364,30 @@ static ValueFlow::Value castValue(ValueFlow::Value value, const ValueType::Sign
     return value;
 }
 
+#ifndef NDEBUG
+/** function scopes of the task that runs in this thread, see valueFlowFunctionBodies() */
+static thread_local const std::vector<const Scope *> *taskFunctionScopes = nullptr;
+
+/** Is the token in one of the function bodies of the task that runs in this thread? */
+static bool isInTaskFunctionScopes(const Token *tok)
+{
+    if (!taskFunctionScopes)
+        return true;
+    for (const Scope *scope = tok->scope(); scope; scope = scope->nestedIn) {
+        if (std::find(taskFunctionScopes->begin(), taskFunctionScopes->end(), scope) != taskFunctionScopes->end())
+            return true;
+    }
+    return false;
+}
+#endif
+
 /** set ValueFlow value and perform calculations if possible */
 static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Settings *settings)
 {
-    if (!tok->addValue(value))
+    // a task must not write values in the function bodies of other tasks
+    assert(isInTaskFunctionScopes(tok));
+
+    if (!tok->addValue(value, settings ? settings->valueFlowMaxValues : ValueFlow::DEFAULT_MAX_VALUES))
         return;
 
     // Don't set parent for uninitialized values
@@ -398,7 +437,7 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
                 const Token *op = cond ? tok->astOperand1() : tok->astOperand2();
                 if (!op) // #7769 segmentation fault at setTokenValue()
                     return;
-                const std::list<ValueFlow::Value> &values = op->values();
+                const std::vector<ValueFlow::Value> &values = op->values();
                 if (std::find(values.begin(), values.end(), value) != values.end())
                     setTokenValue(parent, value, settings);
             }
@@ -729,8 +768,11 @@ static unsigned int getSizeOfType(const Token *typeTok, const Settings *settings
         return typeTok->isLong() ? settings->sizeof_long_long : settings->sizeof_long;
     else if (typeStr == "wchar_t")
         return settings->sizeof_wchar_t;
-    else
-        return 0;
+    else {
+        // pod type from a library, for instance uint8_t
+        const Library::PodType *podtype = settings->library.podtype(typeStr);
+        return podtype ? podtype->size : 0;
+    }
 }
 
 // Handle various constants..
@@ -1334,9 +1376,9 @@ static void valueFlowReverse(TokenList *tokenlist,
     }
 }
 
-static void valueFlowBeforeCondition(TokenList *tokenlist, SymbolDatabase *symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
+static void valueFlowBeforeCondition(TokenList *tokenlist, const std::vector<const Scope *> &functionScopes, ErrorLogger *errorLogger, const Settings *settings)
 {
-    for (const Scope * scope : symboldatabase->functionScopes) {
+    for (const Scope * scope : functionScopes) {
         for (Token* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
             MathLib::bigint num = 0;
             const Token *vartok = nullptr;
@@ -1461,7 +1503,7 @@ static void valueFlowAST(Token *tok, unsigned int varid, const ValueFlow::Value
         if (conditionIsFalse(tok->astOperand1(), pm))
             return;
     } else if (tok->str() == "||" && tok->astOperand1()) {
-        const std::list<ValueFlow::Value> &values = tok->astOperand1()->values();
+        const std::vector<ValueFlow::Value> &values = tok->astOperand1()->values();
         bool nonzero = false;
         for (const ValueFlow::Value &v : values) {
             if (v.intvalue != 0) {
@@ -1596,11 +1638,11 @@ static bool valueFlowForward(Token * const               startToken,
                 bool bailoutflag = false;
                 const Token * const start1 = iselse ? tok2->link()->linkAt(-2) : nullptr;
                 for (std::list<ValueFlow::Value>::iterator it = values.begin(); it != values.end();) {
-                    if (!iselse && conditionIsTrue(condition, getProgramMemory(condition->astParent(), varid, *it))) {
+                    if (!iselse && conditionIsTrue(condition, getProgramMemory(condition->astParent(), condition, varid, *it))) {
                         bailoutflag = true;
                         break;
                     }
-                    if (iselse && conditionIsFalse(condition, getProgramMemory(condition->astParent(), varid, *it))) {
+                    if (iselse && conditionIsFalse(condition, getProgramMemory(condition->astParent(), condition, varid, *it))) {
                         bailoutflag = true;
                         break;
                     }
@@ -1656,7 +1698,7 @@ static bool valueFlowForward(Token * const               startToken,
             condition = condition ? condition->linkAt(-1) : nullptr;
             condition = condition ? condition->astOperand2() : nullptr;
             for (const ValueFlow::Value &v : values) {
-                if (conditionIsTrue(condition, getProgramMemory(tok2, varid, v))) {
+                if (conditionIsTrue(condition, getProgramMemory(tok2, condition, varid, v))) {
                     skipelse = true;
                     break;
                 }
@@ -1721,7 +1763,7 @@ static bool valueFlowForward(Token * const               startToken,
                     falsevalues.push_back(v);
                     continue;
                 }
-                const ProgramMemory &programMemory = getProgramMemory(tok2, varid, v);
+                const ProgramMemory &programMemory = getProgramMemory(tok2, condTok, varid, v);
                 if (subFunction && conditionIsTrue(condTok, programMemory))
                     truevalues.push_back(v);
                 else if (!subFunction && !conditionIsFalse(condTok, programMemory))
@@ -1863,7 +1905,7 @@ static bool valueFlowForward(Token * const               startToken,
             if (isReturnScope(end)) {
                 std::list<ValueFlow::Value>::iterator it;
                 for (it = values.begin(); it != values.end();) {
-                    if (conditionIsTrue(tok2->next()->astOperand2(), getProgramMemory(tok2, varid, *it)))
+                    if (conditionIsTrue(tok2->next()->astOperand2(), getProgramMemory(tok2, tok2->next()->astOperand2(), varid, *it)))
                         values.erase(it++);
                     else
                         ++it;
@@ -1926,7 +1968,7 @@ static bool valueFlowForward(Token * const               startToken,
             if (arg != nullptr && arg->str() != ",") {
                 // Should scope be skipped because variable value is checked?
                 for (std::list<ValueFlow::Value>::iterator it = values.begin(); it != values.end();) {
-                    if (conditionIsFalse(arg, getProgramMemory(tok2, varid, *it)))
+                    if (conditionIsFalse(arg, getProgramMemory(tok2, arg, varid, *it)))
                         values.erase(it++);
                     else
                         ++it;
@@ -2003,7 +2045,7 @@ static bool valueFlowForward(Token * const               startToken,
                     changeKnownToPossible(values);
             } else {
                 for (const ValueFlow::Value &v : values) {
-                    const ProgramMemory programMemory(getProgramMemory(tok2, varid, v));
+                    const ProgramMemory programMemory(getProgramMemory(tok2, condition, varid, v));
                     if (conditionIsTrue(condition, programMemory))
                         valueFlowAST(const_cast<Token*>(op2->astOperand1()), varid, v, settings);
                     else if (conditionIsFalse(condition, programMemory))
@@ -2279,11 +2321,11 @@ static const Token * findEndOfFunctionCallForParameter(const Token * parameterTo
     return nextAfterAstRightmostLeaf(parent);
 }
 
-static void valueFlowAfterMove(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
+static void valueFlowAfterMove(TokenList *tokenlist, const std::vector<const Scope *> &functionScopes, ErrorLogger *errorLogger, const Settings *settings)
 {
     if (!tokenlist->isCPP() || settings->standards.cpp < Standards::CPP11)
         return;
-    for (const Scope * scope : symboldatabase->functionScopes) {
+    for (const Scope * scope : functionScopes) {
         if (!scope)
             continue;
         const Token * start = scope->bodyStart;
@@ -2352,9 +2394,9 @@ static void valueFlowAfterMove(TokenList *tokenlist, SymbolDatabase* symboldatab
     }
 }
 
-static void valueFlowAfterAssign(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
+static void valueFlowAfterAssign(TokenList *tokenlist, const std::vector<const Scope *> &functionScopes, ErrorLogger *errorLogger, const Settings *settings)
 {
-    for (const Scope * scope : symboldatabase->functionScopes) {
+    for (const Scope * scope : functionScopes) {
         std::set<unsigned int> aliased;
         for (Token* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
             // Alias
@@ -2377,13 +2419,14 @@ static void valueFlowAfterAssign(TokenList *tokenlist, SymbolDatabase* symboldat
             if (!var || (!var->isLocal() && !var->isGlobal() && !var->isArgument()))
                 continue;
 
-            const Token * const endOfVarScope = var->typeStartToken()->scope()->bodyEnd;
+            // don't go beyond this function for global variables, other functions might be handled in parallel
+            const Token * const endOfVarScope = var->isLocal() || var->isArgument() ? var->typeStartToken()->scope()->bodyEnd : scope->bodyEnd;
 
             // Rhs values..
             if (!tok->astOperand2() || tok->astOperand2()->values().empty())
                 continue;
 
-            std::list<ValueFlow::Value> values = tok->astOperand2()->values();
+            std::list<ValueFlow::Value> values(tok->astOperand2()->values().begin(), tok->astOperand2()->values().end());
             for (std::list<ValueFlow::Value>::iterator it = values.begin(); it != values.end(); ++it) {
                 const std::string info = "Assignment '" + tok->expressionString() + "', assigned value is " + it->infoString();
                 it->errorPath.emplace_back(tok->astOperand2(), info);
@@ -2412,9 +2455,9 @@ static void valueFlowAfterAssign(TokenList *tokenlist, SymbolDatabase* symboldat
     }
 }
 
-static void valueFlowAfterCondition(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
+static void valueFlowAfterCondition(TokenList *tokenlist, const std::vector<const Scope *> &functionScopes, ErrorLogger *errorLogger, const Settings *settings)
 {
-    for (const Scope * scope : symboldatabase->functionScopes) {
+    for (const Scope * scope : functionScopes) {
         std::set<unsigned> aliased;
         for (Token* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
             const Token * vartok = nullptr;
@@ -2631,7 +2674,7 @@ static void valueFlowAfterCondition(TokenList *tokenlist, SymbolDatabase* symbol
                 if (Token::simpleMatch(top->link(), ") {")) {
                     Token *after = top->link()->linkAt(1);
                     std::string unknownFunction;
-                    if (settings->library.isScopeNoReturn(after, &unknownFunction)) {
+                    if (settings->summaries.isScopeNoReturn(after, settings->library, &unknownFunction)) {
                         if (settings->debugwarnings && !unknownFunction.empty())
                             bailout(tokenlist, errorLogger, after, "possible noreturn scope");
                         continue;
@@ -2717,6 +2760,17 @@ static void execute(const Token *expr,
             *error = true;
     }
 
+    else if (Token::Match(expr, "+=|-=")) {
+        MathLib::bigint result1(0), result2(0);
+        execute(expr->astOperand1(), programMemory, &result1, error);
+        execute(expr->astOperand2(), programMemory, &result2, error);
+        if (!*error && expr->astOperand1()->varId()) {
+            *result = (expr->str() == "+=") ? (result1 + result2) : (result1 - result2);
+            programMemory->setIntValue(expr->astOperand1()->varId(), *result);
+        } else
+            *error = true;
+    }
+
     else if (Token::Match(expr, "++|--")) {
         if (!expr->astOperand1() || expr->astOperand1()->varId() == 0U)
             *error = true;
@@ -2959,7 +3013,7 @@ static void valueFlowForLoopSimplify(Token * const bodyStart, const unsigned int
         }
 
         if (Token::Match(tok2, "%oror%|&&")) {
-            const ProgramMemory programMemory(getProgramMemory(tok2->astTop(), varid, ValueFlow::Value(value)));
+            const ProgramMemory programMemory(getProgramMemory(tok2->astTop(), tok2->astOperand1(), varid, ValueFlow::Value(value)));
             if ((tok2->str() == "&&" && !conditionIsTrue(tok2->astOperand1(), programMemory)) ||
                 (tok2->str() == "||" && !conditionIsFalse(tok2->astOperand1(), programMemory))) {
                 // Skip second expression..
@@ -2976,8 +3030,8 @@ static void valueFlowForLoopSimplify(Token * const bodyStart, const unsigned int
             }
 
         }
-        if ((tok2->str() == "&&" && conditionIsFalse(tok2->astOperand1(), getProgramMemory(tok2->astTop(), varid, ValueFlow::Value(value)))) ||
-            (tok2->str() == "||" && conditionIsTrue(tok2->astOperand1(), getProgramMemory(tok2->astTop(), varid, ValueFlow::Value(value)))))
+        if ((tok2->str() == "&&" && conditionIsFalse(tok2->astOperand1(), getProgramMemory(tok2->astTop(), tok2->astOperand1(), varid, ValueFlow::Value(value)))) ||
+            (tok2->str() == "||" && conditionIsTrue(tok2->astOperand1(), getProgramMemory(tok2->astTop(), tok2->astOperand1(), varid, ValueFlow::Value(value)))))
             break;
 
         else if (Token::simpleMatch(tok2, ") {") && Token::findmatch(tok2->link(), "%varid%", tok2, varid)) {
@@ -3168,9 +3222,9 @@ static void valueFlowSwitchVariable(TokenList *tokenlist, SymbolDatabase* symbol
     }
 }
 
-static void setTokenValues(Token *tok, const std::list<ValueFlow::Value> &values, const Settings *settings)
+static void setTokenValues(Token *tok, const std::vector<ValueFlow::Value> &values, const Settings *settings)
 {
-    for (std::list<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
+    for (std::vector<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
         const ValueFlow::Value &value = *it;
         if (value.isIntValue())
             setTokenValue(tok, value, settings);
@@ -3232,6 +3286,14 @@ static void valueFlowLibraryFunction(Token *tok, const std::string &returnValue,
 
 static void valueFlowSubFunction(TokenList *tokenlist, ErrorLogger *errorLogger, const Settings *settings)
 {
+    // number of values that have been passed into the parameters of each function
+    std::map<const Scope *, std::size_t> functionValues;
+
+    // Summary of the values that have been passed into each parameter. Passing
+    // the same values again would only give the same token values with another
+    // error path, and these are not added by setTokenValue().
+    std::map<const Variable *, std::vector<std::list<ValueFlow::Value> > > injectedValues;
+
     for (Token *tok = tokenlist->front(); tok; tok = tok->next()) {
         if (!Token::Match(tok, "%name% ("))
             continue;
@@ -3263,7 +3325,7 @@ static void valueFlowSubFunction(TokenList *tokenlist, ErrorLogger *errorLogger,
                 argvalues.emplace_back(0);
                 argvalues.emplace_back(1);
             } else {
-                argvalues = argtok->values();
+                argvalues.assign(argtok->values().begin(), argtok->values().end());
             }
 
             if (argvalues.empty())
@@ -3287,6 +3349,21 @@ static void valueFlowSubFunction(TokenList *tokenlist, ErrorLogger *errorLogger,
             // passed values are not "known"..
             changeKnownToPossible(argvalues);
 
+            // Have the same values been passed to the parameter before?
+            std::vector<std::list<ValueFlow::Value> > &summary = injectedValues[argvar];
+            if (std::find(summary.begin(), summary.end(), argvalues) != summary.end())
+                continue;
+
+            // Limit the number of values that are passed into the function
+            std::size_t &functionValueCount = functionValues[calledFunctionScope];
+            if (functionValueCount + argvalues.size() > settings->valueFlowMaxFunctionValues) {
+                if (settings->debugwarnings)
+                    bailout(tokenlist, errorLogger, argtok, "value budget of function '" + calledFunction->name() + "' is exceeded");
+                continue;
+            }
+            functionValueCount += argvalues.size();
+            summary.push_back(argvalues);
+
             valueFlowInjectParameter(tokenlist, errorLogger, settings, argvar, calledFunctionScope, argvalues);
         }
     }
@@ -3304,7 +3381,7 @@ static void valueFlowFunctionDefaultParameter(TokenList *tokenlist, SymbolDataba
         for (std::size_t arg = function->minArgCount(); arg < function->argCount(); arg++) {
             const Variable* var = function->getArgumentVar(arg);
             if (var && var->hasDefault() && Token::Match(var->nameToken(), "%var% = %num%|%str% [,)]")) {
-                const std::list<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
+                const std::vector<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
                 std::list<ValueFlow::Value> argvalues;
                 for (const ValueFlow::Value &value : values) {
                     ValueFlow::Value v(value);
@@ -3327,8 +3404,33 @@ static bool isKnown(const Token * tok)
 
 static void valueFlowFunctionReturn(TokenList *tokenlist, ErrorLogger *errorLogger)
 {
+    // Return values of the functions for the argument values that have been seen
+    // so far. Failed evaluations are not saved, the return expression might get
+    // more known values later.
+    std::map<std::pair<const Scope *, std::vector<MathLib::bigint> >, MathLib::bigint> returnValues;
+
     for (Token *tok = tokenlist->back(); tok; tok = tok->previous()) {
-        if (tok->str() != "(" || !tok->astOperand1() || !tok->astOperand1()->function())
+        if (tok->str() != "(" || !tok->astOperand1())
+            continue;
+
+        // Function defined in another translation unit?
+        if (tok->astOperand1() == tok->previous() &&
+            tok->previous()->isName() &&
+            !Token::Match(tok->tokAt(-2), ".|::") &&
+            (!tok->previous()->function() || !tok->previous()->function()->hasBody())) {
+            Summaries::Function summary;
+            if (tokenlist->getSettings()->summaries.find(tok->previous(), &summary)) {
+                for (MathLib::bigint returnValue : summary.returnValues) {
+                    ValueFlow::Value v(returnValue);
+                    if (summary.returnValues.size() == 1U)
+                        v.setKnown();
+                    setTokenValue(tok, v, tokenlist->getSettings());
+                }
+            }
+            continue;
+        }
+
+        if (!tok->astOperand1()->function())
             continue;
 
         // Arguments..
@@ -3373,12 +3475,20 @@ static void valueFlowFunctionReturn(TokenList *tokenlist, ErrorLogger *errorLogg
             continue;
 
         // Determine return value of subfunction..
+        const std::pair<const Scope *, std::vector<MathLib::bigint> > call(functionScope, parvalues);
         MathLib::bigint result = 0;
         bool error = false;
-        execute(functionScope->bodyStart->next()->astOperand1(),
-                &programMemory,
-                &result,
-                &error);
+        const std::map<std::pair<const Scope *, std::vector<MathLib::bigint> >, MathLib::bigint>::const_iterator it = returnValues.find(call);
+        if (it != returnValues.end()) {
+            result = it->second;
+        } else {
+            execute(functionScope->bodyStart->next()->astOperand1(),
+                    &programMemory,
+                    &result,
+                    &error);
+            if (!error)
+                returnValues[call] = result;
+        }
         if (!error) {
             ValueFlow::Value v(result);
             if (function->isVirtual())
@@ -3631,13 +3741,13 @@ static void valueFlowContainerSize(TokenList *tokenlist, SymbolDatabase* symbold
 
 ValueFlow::Value::Value(const Token *c, long long val)
     : valueType(INT),
+      varId(0U),
       intvalue(val),
       tokvalue(nullptr),
       floatValue(0.0),
       moveKind(NonMovedVariable),
       varvalue(val),
       condition(c),
-      varId(0U),
       conditional(false),
       defaultArg(false),
       valueKind(ValueKind::Possible)
@@ -3675,6 +3785,66 @@ const ValueFlow::Value *ValueFlow::valueFlowConstantFoldAST(const Token *expr, c
 }
 
 
+static void valueFlowFunctionBodies(TokenList *tokenlist, const std::vector<const Scope *> &functionScopes, ErrorLogger *errorLogger, const Settings *settings)
+{
+    valueFlowBeforeCondition(tokenlist, functionScopes, errorLogger, settings);
+    if (settings->valueFlowAnalyses & ValueFlow::ANALYSIS_MOVED)
+        valueFlowAfterMove(tokenlist, functionScopes, errorLogger, settings);
+    valueFlowAfterAssign(tokenlist, functionScopes, errorLogger, settings);
+    valueFlowAfterCondition(tokenlist, functionScopes, errorLogger, settings);
+}
+
+/**
+ * These passes only set values inside the function body they look at.
+ * Function bodies that are not nested in the same function are therefore
+ * independent and are handled in parallel when --threads is used.
+ */
+static void valueFlowFunctionBodies(TokenList *tokenlist, SymbolDatabase *symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
+{
+    if (settings->threads <= 1) {
+        valueFlowFunctionBodies(tokenlist, symboldatabase->functionScopes, errorLogger, settings);
+        return;
+    }
+
+    // Group the function scopes by the outermost executable scope they are nested in
+    std::vector<std::vector<const Scope *> > groups;
+    std::map<const Scope *, std::size_t> groupIndex;
+    for (const Scope *scope : symboldatabase->functionScopes) {
+        const Scope *outer = scope;
+        for (const Scope *s = scope->nestedIn; s; s = s->nestedIn) {
+            if (s->isExecutable())
+                outer = s;
+        }
+        const std::map<const Scope *, std::size_t>::const_iterator it = groupIndex.find(outer);
+        if (it == groupIndex.end()) {
+            groupIndex[outer] = groups.size();
+            groups.push_back(std::vector<const Scope *>(1, scope));
+        } else {
+            groups[it->second].push_back(scope);
+        }
+    }
+
+    std::vector<ErrorBuffer> errorBuffers(groups.size());
+    std::vector<TaskPool::Task> tasks;
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        const std::vector<const Scope *> &group = groups[i];
+        ErrorBuffer *errorBuffer = &errorBuffers[i];
+        tasks.push_back([=]() {
+#ifndef NDEBUG
+            taskFunctionScopes = &group;
+#endif
+            valueFlowFunctionBodies(tokenlist, group, errorBuffer, settings);
+#ifndef NDEBUG
+            taskFunctionScopes = nullptr;
+#endif
+        });
+    }
+    TaskPool::run(settings->threads, tasks);
+
+    for (ErrorBuffer &errorBuffer : errorBuffers)
+        errorBuffer.flush(errorLogger);
+}
+
 void ValueFlow::setValues(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
 {
     for (Token *tok = tokenlist->front(); tok; tok = tok->next())
@@ -3688,17 +3858,22 @@ void ValueFlow::setValues(TokenList *tokenlist, SymbolDatabase* symboldatabase,
     valueFlowFunctionReturn(tokenlist, errorLogger);
     valueFlowBitAnd(tokenlist);
     valueFlowOppositeCondition(symboldatabase, settings);
-    valueFlowBeforeCondition(tokenlist, symboldatabase, errorLogger, settings);
-    valueFlowAfterMove(tokenlist, symboldatabase, errorLogger, settings);
-    valueFlowAfterAssign(tokenlist, symboldatabase, errorLogger, settings);
-    valueFlowAfterCondition(tokenlist, symboldatabase, errorLogger, settings);
+    valueFlowFunctionBodies(tokenlist, symboldatabase, errorLogger, settings);
     valueFlowSwitchVariable(tokenlist, symboldatabase, errorLogger, settings);
     valueFlowForLoop(tokenlist, symboldatabase, errorLogger, settings);
     valueFlowSubFunction(tokenlist, errorLogger, settings);
     valueFlowFunctionDefaultParameter(tokenlist, symboldatabase, errorLogger, settings);
-    valueFlowUninit(tokenlist, symboldatabase, errorLogger, settings);
-    if (tokenlist->isCPP())
+    if (settings->valueFlowAnalyses & ValueFlow::ANALYSIS_UNINIT)
+        valueFlowUninit(tokenlist, symboldatabase, errorLogger, settings);
+    if (tokenlist->isCPP() && (settings->valueFlowAnalyses & ValueFlow::ANALYSIS_CONTAINER_SIZE))
         valueFlowContainerSize(tokenlist, symboldatabase, errorLogger, settings);
+
+    if (settings->debugwarnings) {
+        for (const Token *tok = tokenlist->front(); tok; tok = tok->next()) {
+            if (tok->isValueBudgetExceeded())
+                bailout(tokenlist, errorLogger, tok, "value budget of token '" + tok->str() + "' is exceeded");
+        }
+    }
 }
 
 
@@ -39,7 +39,7 @@ namespace ValueFlow {
         typedef std::pair<const Token *, std::string> ErrorPathItem;
         typedef std::list<ErrorPathItem> ErrorPath;
 
-        explicit Value(long long val = 0) : valueType(INT), intvalue(val), tokvalue(nullptr), floatValue(0.0), moveKind(NonMovedVariable), varvalue(val), condition(nullptr), varId(0U), conditional(false), defaultArg(false), valueKind(ValueKind::Possible) {}
+        explicit Value(long long val = 0) : valueType(INT), varId(0U), intvalue(val), tokvalue(nullptr), floatValue(0.0), moveKind(NonMovedVariable), varvalue(val), condition(nullptr), conditional(false), defaultArg(false), valueKind(ValueKind::Possible) {}
         Value(const Token *c, long long val);
 
         bool operator==(const Value &rhs) const {
@@ -100,6 +100,9 @@ namespace ValueFlow {
             return valueType == CONTAINER_SIZE;
         }
 
+        /** For calculated values - varId that calculated value depends on */
+        unsigned int varId;
+
         /** int value */
         long long intvalue;
 
@@ -120,9 +123,6 @@ namespace ValueFlow {
 
         ErrorPath errorPath;
 
-        /** For calculated values - varId that calculated value depends on */
-        unsigned int varId;
-
         /** Conditional value */
         bool conditional;
 
@@ -186,6 +186,16 @@ namespace ValueFlow {
         }
     };
 
+    /// ValueFlow analyses that only some checks use. Settings::valueFlowAnalyses selects the analyses that are done.
+    enum Analysis {
+        ANALYSIS_MOVED = 1 << 0,          ///< moved variables (MOVED values)
+        ANALYSIS_UNINIT = 1 << 1,         ///< uninitialized variables (UNINIT values)
+        ANALYSIS_CONTAINER_SIZE = 1 << 2  ///< container sizes (CONTAINER_SIZE values)
+    };
+
+    /// Default maximum number of values per token, see Settings::valueFlowMaxValues
+    const unsigned int DEFAULT_MAX_VALUES = 10U;
+
     /// Constant folding of expression. This can be used before the full ValueFlow has been executed (ValueFlow::setValues).
     const ValueFlow::Value * valueFlowConstantFoldAST(const Token *expr, const Settings *settings);
 
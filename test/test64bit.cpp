@@ -226,6 +226,16 @@ private:
               "  return nullptr;\n"
               "}");
         ASSERT_EQUALS("", errout.str());
+
+        // nested functions are checked once, with their own return type
+        check("int *foo(int x) {\n"
+              "  struct S {\n"
+              "    int bar(int *p) { return p; }\n"
+              "  };\n"
+              "  return x;\n"
+              "}");
+        ASSERT_EQUALS("[test.cpp:3]: (portability) Returning an address value in a function with integer return type is not portable.\n"
+                      "[test.cpp:5]: (portability) Returning an integer in a function with pointer return type is not portable.\n", errout.str());
     }
 };
 
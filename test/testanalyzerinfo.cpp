@@ -0,0 +1,342 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "analyzerinfo.h"
+#include "errorlogger.h"
+#include "summaries.h"
+#include "testsuite.h"
+#include "testutils.h"
+
+#include <fstream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class TestAnalyzerInformation : public TestFixture {
+public:
+    TestAnalyzerInformation() : TestFixture("TestAnalyzerInformation") {
+    }
+
+private:
+    void run() override {
+        TEST_CASE(dependencies);
+        TEST_CASE(dependenciesHeaderChanged);
+        TEST_CASE(dependenciesSettingsChanged);
+        TEST_CASE(replayErrors);
+
+        // the store in the build dir
+        TEST_CASE(appendAndLookup);
+        TEST_CASE(lastEntryWins);
+        TEST_CASE(hashCollision);
+        TEST_CASE(compactRemovesTranslationUnits);
+        TEST_CASE(staleIndex);
+        TEST_CASE(corruptStore);
+    }
+
+    static ErrorLogger::ErrorMessage errorMessage(const std::string &file, unsigned int line, const std::string &id) {
+        std::list<ErrorLogger::ErrorMessage::FileLocation> locations;
+        locations.emplace_back(file, line);
+        return ErrorLogger::ErrorMessage(locations, emptyString, Severity::warning, "message", id, false);
+    }
+
+    /** Analyze the source file and record the files it includes, the results are reused if the checksum is unchanged */
+    static void analyze(const std::string &buildDir, const std::string &sourcefile, unsigned long long checksum, const std::string &settings, const std::vector<std::string> &files, const std::string &id) {
+        const Summaries summaries;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        AnalyzerInformation analyzerInformation;
+        analyzerInformation.analyzeFile(buildDir, sourcefile, emptyString, checksum, summaries, &errors);
+        analyzerInformation.setDependencies(settings, files);
+        analyzerInformation.reportErr(errorMessage(sourcefile, 2U, id), false);
+        analyzerInformation.close();
+        AnalyzerInformation::compact(buildDir, std::list<std::string>(1, sourcefile), std::list<ImportProject::FileSettings>());
+    }
+
+    /** The ids of the cached errors, "-" if the file must be analyzed again */
+    static std::string unchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &settings) {
+        const Summaries summaries;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        if (!AnalyzerInformation::isUnchanged(buildDir, sourcefile, emptyString, settings, summaries, &errors))
+            return "-";
+        std::string ids;
+        for (const ErrorLogger::ErrorMessage &message : errors)
+            ids += message._id + ' ';
+        return ids;
+    }
+
+    /** Append an entry for the TU to the store, with an error and file info that are both named by id */
+    static void append(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, unsigned long long checksum, const std::string &id) {
+        const Summaries summaries;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        AnalyzerInformation analyzerInformation;
+        analyzerInformation.analyzeFile(buildDir, sourcefile, cfg, checksum, summaries, &errors);
+        analyzerInformation.setDependencies("settings", std::vector<std::string>(1, sourcefile));
+        analyzerInformation.reportErr(errorMessage(sourcefile, 2U, id), false);
+        analyzerInformation.setFileInfo("check", id);
+        analyzerInformation.close();
+    }
+
+    static void compact(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::string &cfg = emptyString) {
+        std::list<ImportProject::FileSettings> fileSettings;
+        if (!cfg.empty()) {
+            for (const std::string &sourcefile : sourcefiles) {
+                ImportProject::FileSettings fs;
+                fs.filename = sourcefile;
+                fs.cfg = cfg;
+                fileSettings.push_back(fs);
+            }
+        }
+        AnalyzerInformation::compact(buildDir, sourcefiles, fileSettings);
+    }
+
+    /** The ids of the cached errors of the TU that is looked up in the index, "-" if it is not found */
+    static std::string lookup(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg = emptyString) {
+        const Summaries summaries;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        if (!AnalyzerInformation::isUnchanged(buildDir, sourcefile, cfg, "settings", summaries, &errors))
+            return "-";
+        std::string ids;
+        for (const ErrorLogger::ErrorMessage &message : errors)
+            ids += message._id + ' ';
+        return ids;
+    }
+
+    /** The file info of all TUs in the store */
+    static std::string fileInfo(const std::string &buildDir) {
+        std::list<AnalyzerInformation::FileInfo> fileInfo;
+        AnalyzerInformation::getFileInfo(buildDir, &fileInfo);
+        std::string ret;
+        for (const AnalyzerInformation::FileInfo &info : fileInfo)
+            ret += info.data + ' ';
+        return ret;
+    }
+
+    static std::string readFile(const std::string &filename) {
+        std::ifstream fin(filename, std::ios::binary);
+        std::ostringstream ostr;
+        ostr << fin.rdbuf();
+        return ostr.str();
+    }
+
+    void dependencies() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string header = buildDir.write("test.h", "int x;\n");
+        const std::string source = buildDir.write("test.cpp", "#include \"test.h\"\n");
+        std::vector<std::string> files;
+        files.push_back(source);
+        files.push_back(header);
+
+        ASSERT_EQUALS("-", unchanged(buildDir.path, source, "settings"));
+        analyze(buildDir.path, source, 1U, "settings", files, "id1");
+        ASSERT_EQUALS("id1 ", unchanged(buildDir.path, source, "settings"));
+
+        // the record is only written if all files exist
+        files.push_back(buildDir.path + "/missing.h");
+        analyze(buildDir.path, source, 2U, "settings", files, "id2");
+        ASSERT_EQUALS("-", unchanged(buildDir.path, source, "settings"));
+    }
+
+    void dependenciesHeaderChanged() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string header = buildDir.write("test.h", "int x;\n");
+        const std::string source = buildDir.write("test.cpp", "#include \"test.h\"\n");
+        std::vector<std::string> files;
+        files.push_back(source);
+        files.push_back(header);
+
+        analyze(buildDir.path, source, 1U, "settings", files, "id1");
+        ASSERT_EQUALS("id1 ", unchanged(buildDir.path, source, "settings"));
+        buildDir.write("test.h", "int x, y;\n");
+        ASSERT_EQUALS("-", unchanged(buildDir.path, source, "settings"));
+    }
+
+    void dependenciesSettingsChanged() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string source = buildDir.write("test.cpp", "int x;\n");
+
+        analyze(buildDir.path, source, 1U, "settings", std::vector<std::string>(1, source), "id1");
+        ASSERT_EQUALS("id1 ", unchanged(buildDir.path, source, "settings"));
+        ASSERT_EQUALS("-", unchanged(buildDir.path, source, "other settings"));
+    }
+
+    void replayErrors() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const Summaries summaries;
+        std::list<ErrorLogger::ErrorMessage::FileLocation> locations;
+        locations.emplace_back("test.cpp", "first", 3U);
+        locations.emplace_back("test.h", "second", 1U);
+        locations.emplace_back("test.cpp", "third", 2U);
+        const ErrorLogger::ErrorMessage message(locations, emptyString, Severity::error, "message", "id1", false);
+
+        std::list<ErrorLogger::ErrorMessage> errors;
+        AnalyzerInformation analyzerInformation;
+        ASSERT_EQUALS(true, analyzerInformation.analyzeFile(buildDir.path, "test.cpp", emptyString, 1U, summaries, &errors));
+        analyzerInformation.reportErr(message, false);
+        analyzerInformation.reportErr(errorMessage("test.cpp", 4U, "id2"), false);
+        analyzerInformation.close();
+        AnalyzerInformation::compact(buildDir.path, std::list<std::string>(1, "test.cpp"), std::list<ImportProject::FileSettings>());
+
+        // the errors and their locations are replayed in the order they were reported
+        ASSERT_EQUALS(false, analyzerInformation.analyzeFile(buildDir.path, "test.cpp", emptyString, 1U, summaries, &errors));
+        ASSERT_EQUALS(2U, errors.size());
+        ASSERT_EQUALS(message.serialize(), errors.front().serialize());
+        std::string replayed;
+        for (const ErrorLogger::ErrorMessage::FileLocation &loc : errors.front()._callStack)
+            replayed += loc.getinfo() + ' ';
+        ASSERT_EQUALS("first second third ", replayed);
+        ASSERT_EQUALS("id2", errors.back()._id);
+    }
+
+    void appendAndLookup() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string a = buildDir.write("a.cpp", "int a;\n");
+        const std::string b = buildDir.write("b.cpp", "int b;\n");
+        std::list<std::string> sourcefiles;
+        sourcefiles.push_back(a);
+        sourcefiles.push_back(b);
+
+        append(buildDir.path, a, emptyString, 1U, "a");
+        append(buildDir.path, b, emptyString, 1U, "b");
+        append(buildDir.path, a, "cfg", 1U, "a-cfg");
+
+        // the entries are looked up in the index that compact() writes
+        ASSERT_EQUALS("-", lookup(buildDir.path, a));
+        ASSERT_EQUALS("a a-cfg b ", fileInfo(buildDir.path));
+
+        compact(buildDir.path, sourcefiles);
+        ASSERT_EQUALS("a ", lookup(buildDir.path, a));
+        ASSERT_EQUALS("b ", lookup(buildDir.path, b));
+        ASSERT_EQUALS("-", lookup(buildDir.path, a, "cfg"));
+
+        // the entry of the cfg was removed since it was not checked
+        append(buildDir.path, a, "cfg", 1U, "a-cfg");
+        compact(buildDir.path, sourcefiles, "cfg");
+        ASSERT_EQUALS("a ", lookup(buildDir.path, a));
+        ASSERT_EQUALS("a-cfg ", lookup(buildDir.path, a, "cfg"));
+    }
+
+    void lastEntryWins() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string a = buildDir.write("a.cpp", "int a;\n");
+
+        append(buildDir.path, a, emptyString, 1U, "first");
+        append(buildDir.path, a, emptyString, 2U, "second");
+        ASSERT_EQUALS("second ", fileInfo(buildDir.path));
+        compact(buildDir.path, std::list<std::string>(1, a));
+        ASSERT_EQUALS("second ", lookup(buildDir.path, a));
+        ASSERT_EQUALS("second ", fileInfo(buildDir.path));
+
+        // an entry that is appended after compact() is only seen by the whole program analysis until the next compact()
+        append(buildDir.path, a, emptyString, 3U, "third");
+        ASSERT_EQUALS("second ", lookup(buildDir.path, a));
+        ASSERT_EQUALS("third ", fileInfo(buildDir.path));
+        compact(buildDir.path, std::list<std::string>(1, a));
+        ASSERT_EQUALS("third ", lookup(buildDir.path, a));
+    }
+
+    void hashCollision() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string a = buildDir.write("a.cpp", "int a;\n");
+        const std::string b = buildDir.write("b.cpp", "int b;\n");
+        std::list<std::string> sourcefiles;
+        sourcefiles.push_back(a);
+        sourcefiles.push_back(b);
+        append(buildDir.path, a, emptyString, 1U, "a");
+        append(buildDir.path, b, emptyString, 1U, "b");
+        compact(buildDir.path, sourcefiles);
+
+        // give both index items the hash of a.cpp, the entry of a.cpp is at offset 0 and is listed last
+        std::string index = readFile(buildDir.path + "/analyzerinfo.idx");
+        ASSERT_EQUALS(12U + 2U * 16U, index.size());
+        const std::string::size_type itemA = (index.compare(12 + 8, 8, std::string(8, '\0')) == 0) ? 12 : 28;
+        const std::string itemB = index.substr(itemA == 12 ? 28 : 12, 16);
+        index = index.substr(0, 12) + index.substr(itemA, 8) + itemB.substr(8) + index.substr(itemA, 16);
+        buildDir.write("analyzerinfo.idx", index);
+
+        ASSERT_EQUALS("a ", lookup(buildDir.path, a));
+        ASSERT_EQUALS("-", lookup(buildDir.path, b));
+    }
+
+    void compactRemovesTranslationUnits() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string a = buildDir.write("a.cpp", "int a;\n");
+        const std::string b = buildDir.write("b.cpp", "int b;\n");
+        append(buildDir.path, a, emptyString, 1U, "a");
+        append(buildDir.path, b, emptyString, 1U, "b");
+        append(buildDir.path, a, "cfg", 1U, "a-cfg");
+
+        compact(buildDir.path, std::list<std::string>(1, a));
+        ASSERT_EQUALS("a ", lookup(buildDir.path, a));
+        ASSERT_EQUALS("-", lookup(buildDir.path, b));
+        ASSERT_EQUALS("-", lookup(buildDir.path, a, "cfg"));
+        ASSERT_EQUALS("a ", fileInfo(buildDir.path));
+    }
+
+    void staleIndex() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string a = buildDir.write("a.cpp", "int a;\n");
+        const std::string b = buildDir.write("b.cpp", "int b;\n");
+        std::list<std::string> sourcefiles;
+        sourcefiles.push_back(a);
+        sourcefiles.push_back(b);
+        append(buildDir.path, a, emptyString, 1U, "a");
+        append(buildDir.path, b, emptyString, 1U, "b");
+        compact(buildDir.path, sourcefiles);
+        const std::string index = readFile(buildDir.path + "/analyzerinfo.idx");
+
+        // the offsets in the old index point to other entries or into the middle of an entry
+        compact(buildDir.path, std::list<std::string>(1, b));
+        buildDir.write("analyzerinfo.idx", index);
+        ASSERT_EQUALS("-", lookup(buildDir.path, a));
+        ASSERT_EQUALS("-", lookup(buildDir.path, b));
+        ASSERT_EQUALS("b ", fileInfo(buildDir.path));
+    }
+
+    void corruptStore() {
+        TemporaryBuildDir buildDir("testanalyzerinfo.dir");
+        const std::string a = buildDir.write("a.cpp", "int a;\n");
+        append(buildDir.path, a, emptyString, 1U, "a");
+        compact(buildDir.path, std::list<std::string>(1, a));
+        const std::string store = readFile(buildDir.path + "/analyzerinfo.dat");
+
+        // an error that can't be deserialized is not replayed, the TU is analyzed again
+        const std::string location = "2:" + a + '\t';
+        const std::string::size_type pos = store.find(location);
+        ASSERT(pos != std::string::npos);
+        buildDir.write("analyzerinfo.dat", store.substr(0, pos) + "2x" + store.substr(pos + 2));
+        ASSERT_EQUALS("-", lookup(buildDir.path, a));
+        {
+            const Summaries summaries;
+            std::list<ErrorLogger::ErrorMessage> errors;
+            AnalyzerInformation analyzerInformation;
+            ASSERT_EQUALS(true, analyzerInformation.analyzeFile(buildDir.path, a, emptyString, 1U, summaries, &errors));
+            ASSERT_EQUALS(0U, errors.size());
+        }
+
+        // sizes that are larger than the file are not used
+        buildDir.write("analyzerinfo.dat", std::string(4, '\xff') + store.substr(4));
+        ASSERT_EQUALS("-", lookup(buildDir.path, a));
+        ASSERT_EQUALS("", fileInfo(buildDir.path));
+        buildDir.write("analyzerinfo.dat", store.substr(0, store.size() - 1));
+        ASSERT_EQUALS("-", lookup(buildDir.path, a));
+        ASSERT_EQUALS("", fileInfo(buildDir.path));
+    }
+};
+
+REGISTER_TEST(TestAnalyzerInformation)
@@ -41,7 +41,7 @@ private:
 
         // Check..
         CheckAssert checkAssert(&tokenizer, &settings, this);
-        checkAssert.runSimplifiedChecks(&tokenizer, &settings, this);
+        checkAssert.runChecks(&tokenizer, &settings, this);
     }
 
     void run() override {
@@ -47,8 +47,6 @@ private:
         checkAutoVariables.assignFunctionArg();
 
         if (runSimpleChecks) {
-            tokenizer.simplifyTokenList2();
-
             // Check auto variables
             checkAutoVariables.autoVariables();
             checkAutoVariables.returnPointerToLocalArray();
@@ -0,0 +1,169 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "check.h"
+#include "settings.h"
+#include "symboldatabase.h"
+#include "testsuite.h"
+#include "token.h"
+#include "tokenize.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class TestCheck : public TestFixture {
+public:
+    TestCheck() : TestFixture("TestCheck") {
+    }
+
+private:
+    Settings settings;
+
+    void run() override {
+        TEST_CASE(visitOrder);
+        TEST_CASE(enterLeave);
+        TEST_CASE(nestedScopes);
+        TEST_CASE(events);
+        TEST_CASE(severalVisitors);
+    }
+
+    /** Records the events as text: "<name" and ">name" for the scopes, "name()" for the function calls */
+    class RecordingVisitor : public TokenVisitor {
+    public:
+        explicit RecordingVisitor(unsigned int events) : mEvents(events) {
+        }
+
+        unsigned int events() const override {
+            return mEvents;
+        }
+
+        void enterScope(const Scope *scope) override {
+            add("<" + scopeName(scope));
+        }
+
+        void leaveScope(const Scope *scope) override {
+            add(">" + scopeName(scope));
+        }
+
+        void visitToken(const Token *tok) override {
+            add(tok->str());
+        }
+
+        void visitFunctionCall(const Token *tok) override {
+            add(tok->str() + "()");
+        }
+
+        std::string trace;
+
+    private:
+        void add(const std::string &s) {
+            if (!trace.empty())
+                trace += ' ';
+            trace += s;
+        }
+
+        static std::string scopeName(const Scope *scope) {
+            switch (scope->type) {
+            case Scope::eFunction:
+            case Scope::eStruct:
+                return scope->className;
+            case Scope::eIf:
+                return "if";
+            case Scope::eElse:
+                return "else";
+            case Scope::eWhile:
+                return "while";
+            default:
+                return "?";
+            }
+        }
+
+        const unsigned int mEvents;
+    };
+
+    std::string walk(const char code[], unsigned int events) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+
+        RecordingVisitor visitor(events);
+        TokenVisitor::walk(&tokenizer, std::vector<TokenVisitor *>(1, &visitor));
+        return visitor.trace;
+    }
+
+    void visitOrder() {
+        // the braces of the function body are not visited
+        ASSERT_EQUALS("a ( ) ; b = 1 ; c ( b ) ;",
+                      walk("void f() { a(); b = 1; c(b); }", TokenVisitor::TOKEN));
+        // the functions are visited in the order of the symbol database
+        ASSERT_EQUALS("a ( ) ; b ( ) ;",
+                      walk("void f() { a(); }\n"
+                           "void g() { b(); }", TokenVisitor::TOKEN));
+    }
+
+    void enterLeave() {
+        // each enterScope() is followed by a leaveScope() for the same scope
+        ASSERT_EQUALS("<f <if >if <else <while >while >else >f <g >g",
+                      walk("void f(int x) {\n"
+                           "    if (x) { a(); }\n"
+                           "    else { while (x) { b(); } }\n"
+                           "}\n"
+                           "void g() { }", TokenVisitor::SCOPE));
+    }
+
+    void nestedScopes() {
+        // a function in a local class is walked together with the enclosing function,
+        // a function call is sent after the token of the name
+        ASSERT_EQUALS("<f struct S <S { void m m() ( ) <m { a a() ( ) ; } >m } >S ; b b() ( ) ; >f",
+                      walk("void f() {\n"
+                           "    struct S { void m() { a(); } };\n"
+                           "    b();\n"
+                           "}", TokenVisitor::TOKEN | TokenVisitor::FUNCTION_CALL | TokenVisitor::SCOPE));
+    }
+
+    void events() {
+        // only the events that the visitor subscribes to are sent, control flow keywords are not function calls
+        ASSERT_EQUALS("a() c()",
+                      walk("void f(int x) { a(); if (x) { c(x); } }", TokenVisitor::FUNCTION_CALL));
+        ASSERT_EQUALS("", walk("void f(int x) { a(); }", 0));
+    }
+
+    void severalVisitors() {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("void f(int x) { if (x) { a(); } }");
+        tokenizer.tokenize(istr, "test.cpp");
+
+        RecordingVisitor scopes(TokenVisitor::SCOPE);
+        RecordingVisitor calls(TokenVisitor::FUNCTION_CALL);
+        RecordingVisitor all(TokenVisitor::TOKEN | TokenVisitor::FUNCTION_CALL | TokenVisitor::SCOPE);
+        std::vector<TokenVisitor *> visitors;
+        visitors.push_back(&scopes);
+        visitors.push_back(&calls);
+        visitors.push_back(&all);
+        TokenVisitor::walk(&tokenizer, visitors);
+
+        // every visitor gets the same events as if it was walked alone
+        ASSERT_EQUALS("<f <if >if >f", scopes.trace);
+        ASSERT_EQUALS("a()", calls.trace);
+        ASSERT_EQUALS("<f if ( x ) <if { a a() ( ) ; } >if >f", all.trace);
+    }
+};
+
+REGISTER_TEST(TestCheck)
@@ -0,0 +1,103 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "chunkedlist.h"
+#include "testsuite.h"
+
+#include <string>
+
+class TestChunkedList : public TestFixture {
+public:
+    TestChunkedList() : TestFixture("TestChunkedList") {
+    }
+
+private:
+
+    void run() override {
+        TEST_CASE(iterate);
+        TEST_CASE(stableAddresses);
+        TEST_CASE(popBack);
+        TEST_CASE(copy);
+    }
+
+    void iterate() const {
+        ChunkedList<int> list;
+        ASSERT_EQUALS(true, list.empty());
+        ASSERT(list.begin() == list.end());
+        for (int i = 0; i < 100; ++i)
+            list.push_back(i);
+        ASSERT_EQUALS(100U, list.size());
+        ASSERT_EQUALS(0, list.front());
+        ASSERT_EQUALS(99, list.back());
+
+        int expected = 0;
+        for (ChunkedList<int>::const_iterator it = list.cbegin(); it != list.cend(); ++it)
+            ASSERT_EQUALS(expected++, *it);
+        ASSERT_EQUALS(100, expected);
+
+        for (ChunkedList<int>::const_reverse_iterator it = list.rbegin(); it != list.rend(); ++it)
+            ASSERT_EQUALS(--expected, *it);
+        ASSERT_EQUALS(0, expected);
+
+        ChunkedList<int>::iterator it = list.end();
+        --it;
+        *it = 1000;
+        ASSERT_EQUALS(1000, list.back());
+    }
+
+    void stableAddresses() const {
+        ChunkedList<std::string> list;
+        list.emplace_back("first");
+        const std::string *first = &list.front();
+        ChunkedList<std::string>::const_iterator it = list.begin();
+        for (int i = 0; i < 1000; ++i)
+            list.emplace_back(3, 'x');
+        ASSERT_EQUALS(true, first == &list.front());
+        ASSERT_EQUALS("first", *it);
+        ++it;
+        ASSERT_EQUALS("xxx", *it);
+    }
+
+    void popBack() const {
+        ChunkedList<std::string> list;
+        for (int i = 0; i < 5; ++i)
+            list.push_back(std::to_string(i));
+        list.pop_back();
+        list.pop_back();
+        ASSERT_EQUALS(3U, list.size());
+        ASSERT_EQUALS("2", list.back());
+        list.push_back("x");
+        ASSERT_EQUALS("x", list.back());
+        list.clear();
+        ASSERT_EQUALS(true, list.empty());
+    }
+
+    void copy() const {
+        ChunkedList<std::string> list;
+        for (int i = 0; i < 10; ++i)
+            list.push_back(std::to_string(i));
+        ChunkedList<std::string> list2(list);
+        list.back() = "x";
+        ASSERT_EQUALS(10U, list2.size());
+        ASSERT_EQUALS("9", list2.back());
+        list2 = list;
+        ASSERT_EQUALS("x", list2.back());
+    }
+};
+
+REGISTER_TEST(TestChunkedList)
@@ -54,6 +54,7 @@ private:
         TEST_CASE(verboselong);
         TEST_CASE(debugSimplified);
         TEST_CASE(debugwarnings);
+        TEST_CASE(debugPeephole);
         TEST_CASE(forceshort);
         TEST_CASE(forcelong);
         TEST_CASE(relativePaths);
@@ -101,6 +102,11 @@ private:
         TEST_CASE(maxConfigsMissingCount);
         TEST_CASE(maxConfigsInvalid);
         TEST_CASE(maxConfigsTooSmall);
+        TEST_CASE(threads);
+        TEST_CASE(threadsInvalid);
+        TEST_CASE(valueFlowMaxValues);
+        TEST_CASE(valueFlowMaxValuesInvalid);
+        TEST_CASE(valueFlowMaxFunctionValues);
         TEST_CASE(reportProgressTest); // "Test" suffix to avoid hiding the parent's reportProgress
         TEST_CASE(stdposix);
         TEST_CASE(stdc99);
@@ -240,6 +246,14 @@ private:
         ASSERT_EQUALS(true, settings.debugwarnings);
     }
 
+    void debugPeephole() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--debug-peephole", "file.cpp"};
+        settings.debugPeephole = false;
+        ASSERT(defParser.parseFromArgs(3, argv));
+        ASSERT_EQUALS(true, settings.debugPeephole);
+    }
+
     void forceshort() {
         REDIRECT;
         const char *argv[] = {"cppcheck", "-f", "file.cpp"};
@@ -679,6 +693,44 @@ private:
         ASSERT_EQUALS(false, defParser.parseFromArgs(3, argv));
     }
 
+    void threads() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--threads=4", "file.cpp"};
+        settings.threads = 1;
+        ASSERT(defParser.parseFromArgs(3, argv));
+        ASSERT_EQUALS(4, settings.threads);
+    }
+
+    void threadsInvalid() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--threads=0", "file.cpp"};
+        // Fails since at least one thread is needed
+        ASSERT_EQUALS(false, defParser.parseFromArgs(3, argv));
+    }
+
+    void valueFlowMaxValues() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--valueflow-max-values=20", "file.cpp"};
+        settings.valueFlowMaxValues = 10;
+        ASSERT(defParser.parseFromArgs(3, argv));
+        ASSERT_EQUALS(20, settings.valueFlowMaxValues);
+    }
+
+    void valueFlowMaxValuesInvalid() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--valueflow-max-values=0", "file.cpp"};
+        // Fails since a token must be able to have a value
+        ASSERT_EQUALS(false, defParser.parseFromArgs(3, argv));
+    }
+
+    void valueFlowMaxFunctionValues() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--valueflow-max-function-values=50", "file.cpp"};
+        settings.valueFlowMaxFunctionValues = 1000;
+        ASSERT(defParser.parseFromArgs(3, argv));
+        ASSERT_EQUALS(50, settings.valueFlowMaxFunctionValues);
+    }
+
     void reportProgressTest() {
         REDIRECT;
         const char *argv[] = {"cppcheck", "--report-progress", "file.cpp"};
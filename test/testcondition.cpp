@@ -134,8 +134,6 @@ private:
         // Run checks..
         CheckCondition checkCondition;
         checkCondition.runChecks(&tokenizer, &settings0, this);
-        tokenizer.simplifyTokenList2();
-        checkCondition.runSimplifiedChecks(&tokenizer, &settings0, this);
     }
 
     void assignAndCompare() {
@@ -504,8 +502,6 @@ private:
 
         CheckCondition checkCondition;
         checkCondition.runChecks(&tokenizer, &settings1, this);
-        tokenizer.simplifyTokenList2();
-        checkCondition.runSimplifiedChecks(&tokenizer, &settings1, this);
     }
 
     void duplicateIf() {
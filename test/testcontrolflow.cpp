@@ -0,0 +1,282 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "controlflow.h"
+#include "settings.h"
+#include "symboldatabase.h"
+#include "taskpool.h"
+#include "testsuite.h"
+#include "token.h"
+#include "tokenize.h"
+
+#include <vector>
+
+class TestControlFlow : public TestFixture {
+public:
+    TestControlFlow() : TestFixture("TestControlFlow") {
+    }
+
+private:
+    Settings settings;
+
+    void run() override {
+        LOAD_LIB_2(settings.library, "std.cfg");
+
+        TEST_CASE(sequence);
+        TEST_CASE(ifElse);
+        TEST_CASE(whileLoop);
+        TEST_CASE(doWhileLoop);
+        TEST_CASE(forLoop);
+        TEST_CASE(rangeForLoop);
+        TEST_CASE(breakContinue);
+        TEST_CASE(switchCase);
+        TEST_CASE(gotoLabel);
+        TEST_CASE(tryCatch);
+        TEST_CASE(noreturn);
+        TEST_CASE(unreachable);
+        TEST_CASE(lambda);
+        TEST_CASE(concurrentUse);
+    }
+
+    std::string cfg(const char code[]) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        const SymbolDatabase *symbolDatabase = tokenizer.getSymbolDatabase();
+        const ControlFlowGraph *graph = symbolDatabase->getControlFlowGraph(symbolDatabase->functionScopes.back());
+        return graph ? graph->str() : "";
+    }
+
+    void sequence() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [int x] [x = 1] [int y] [y = x] -> 1\n",
+                      cfg("void f() { int x; x = 1; int y; y = x; }"));
+    }
+
+    void ifElse() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [int x] [a] -> 3(true) 4(false)\n"
+                      "3: [x = 1] -> 4\n"
+                      "4: [x = 2] -> 1\n",
+                      cfg("void f(int a) { int x; if (a) { x = 1; } x = 2; }"));
+
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [int x] [a] -> 3(true) 4(false)\n"
+                      "3: [x = 1] -> 5\n"
+                      "4: [x = 2] -> 5\n"
+                      "5: [return x] -> 1(jump)\n",
+                      cfg("int f(int a) { int x; if (a) { x = 1; } else { x = 2; } return x; }"));
+
+        // if (0)
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [0] -> 4(false)\n"
+                      "3: [g ( )] -> 4\n"
+                      "4: -> 1\n",
+                      cfg("void f() { if (0) { g(); } }"));
+    }
+
+    void whileLoop() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 3\n"
+                      "3: [a] -> 4(true) 5(false)\n"
+                      "4: [a --] -> 3\n"
+                      "5: -> 1\n",
+                      cfg("void f(int a) { while (a) { a--; } }"));
+
+        // infinite loop, the exit is not reachable
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 3\n"
+                      "3: [1] -> 4(true)\n"
+                      "4: [g ( )] -> 3\n",
+                      cfg("void f() { while (1) { g(); } }"));
+    }
+
+    void doWhileLoop() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 3\n"
+                      "3: [a --] -> 4\n"
+                      "4: [a] -> 3(true) 5(false)\n"
+                      "5: -> 1\n",
+                      cfg("void f(int a) { do { a--; } while (a); }"));
+    }
+
+    void forLoop() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [int i = 0] -> 3\n"
+                      "3: [i < 10] -> 4(true) 6(false)\n"
+                      "4: [g ( i )] -> 5\n"
+                      "5: [i ++] -> 3\n"
+                      "6: -> 1\n",
+                      cfg("void f() { for (int i = 0; i < 10; i++) { g(i); } }"));
+
+        // for (;;) is an infinite loop
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 3\n"
+                      "3: -> 4(true)\n"
+                      "4: [g ( )] -> 5\n"
+                      "5: -> 3\n",
+                      cfg("void f() { for (;;) { g(); } }"));
+    }
+
+    void rangeForLoop() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 3\n"
+                      "3: [int x : v] -> 4(true) 6(false)\n"
+                      "4: [g ( x )] -> 5\n"
+                      "5: -> 3\n"
+                      "6: -> 1\n",
+                      cfg("void f(std::vector<int> v) { for (int x : v) { g(x); } }"));
+    }
+
+    void breakContinue() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 3\n"
+                      "3: [a] -> 4(true) 5(false)\n"
+                      "4: [b] -> 6(true) 8(false)\n"
+                      "5: -> 1\n"
+                      "6: [break] -> 5(jump)\n"
+                      "8: [c] -> 9(true) 11(false)\n"
+                      "9: [continue] -> 3(jump)\n"
+                      "11: [g ( )] -> 3\n",
+                      cfg("void f(int a, int b, int c) { while (a) { if (b) { break; } if (c) { continue; } g(); } }"));
+    }
+
+    void switchCase() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [int x] [a] -> 5(jump) 7(jump) 3(false)\n"
+                      "3: -> 1\n"
+                      "5: [x = 1] [break] -> 3(jump)\n"
+                      "7: [x = 2] -> 3\n",
+                      cfg("void f(int a) { int x; switch (a) { case 1: x = 1; break; case 2: x = 2; } }"));
+
+        // with default there is no edge from the switch to the block after it
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [a] -> 5(jump) 7(jump)\n"
+                      "3: -> 1\n"
+                      "5: [break] -> 3(jump)\n"
+                      "7: [break] -> 3(jump)\n",
+                      cfg("void f(int a) { switch (a) { case 1: break; default: break; } }"));
+    }
+
+    void gotoLabel() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [a] -> 3(true) 5(false)\n"
+                      "3: [goto out] -> 6(jump)\n"
+                      "5: [g ( )] -> 6\n"
+                      "6: [return] -> 1(jump)\n",
+                      cfg("void f(int a) { if (a) { goto out; } g(); out: return; }"));
+    }
+
+    void tryCatch() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 4\n"
+                      "3: [. . .] [h ( )] -> 5\n"
+                      "4: [g ( )] -> 3(exception) 5\n"
+                      "5: -> 1\n",
+                      cfg("void f() { try { g(); } catch (...) { h(); } }"));
+
+        // blocks of a nested try block throw to its own handlers only
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: -> 4\n"
+                      "3: [. . .] [e ( )] -> 8\n"
+                      "4: [a ( )] -> 6 3(exception)\n"
+                      "5: [int] [c ( )] -> 7 3(exception)\n"
+                      "6: [b ( )] -> 5(exception) 7\n"
+                      "7: [d ( )] -> 3(exception) 8\n"
+                      "8: -> 1\n",
+                      cfg("void f() { try { a(); try { b(); } catch (int) { c(); } d(); } catch (...) { e(); } }"));
+
+        // throw outside try block leaves the function
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [throw 1] -> 1(exception)\n",
+                      cfg("void f() { throw 1; }"));
+    }
+
+    void noreturn() {
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [a] -> 3(true) 5(false)\n"
+                      "3: [exit ( 1 )] -> 1(noreturn)\n"
+                      "5: [g ( )] -> 1\n",
+                      cfg("void f(int a) { if (a) { exit(1); } g(); }"));
+    }
+
+    void unreachable() {
+        const char code[] = "int f() { return 0; g(); }";
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        const SymbolDatabase *symbolDatabase = tokenizer.getSymbolDatabase();
+        const ControlFlowGraph *graph = symbolDatabase->getControlFlowGraph(symbolDatabase->functionScopes.front());
+        ASSERT(graph != nullptr);
+        const ControlFlowGraph::BasicBlock *block = graph->findBlock(Token::findsimplematch(tokenizer.tokens(), "g ("));
+        ASSERT(block != nullptr);
+        ASSERT_EQUALS(false, graph->isReachable(block->index));
+        ASSERT_EQUALS(true, graph->isReachable(graph->findBlock(Token::findsimplematch(tokenizer.tokens(), "return"))->index));
+    }
+
+    void lambda() {
+        // the lambda body is a part of the statement
+        ASSERT_EQUALS("0: -> 2\n"
+                      "1:\n"
+                      "2: [auto g] [g = [ ] ( ) { return 1 ; }] [g ( )] -> 1\n",
+                      cfg("void f() { auto g = []() { return 1; }; g(); }"));
+    }
+
+    void concurrentUse() {
+        // checks running in parallel get the same graph
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("void f(int a) { if (a) { g(); } }");
+        tokenizer.tokenize(istr, "test.cpp");
+        const SymbolDatabase *symbolDatabase = tokenizer.getSymbolDatabase();
+        const Scope *scope = symbolDatabase->functionScopes.front();
+
+        std::vector<const ControlFlowGraph *> graphs(8, nullptr);
+        std::vector<TaskPool::Task> tasks;
+        for (std::size_t i = 0; i < graphs.size(); ++i) {
+            tasks.push_back([&graphs, i, symbolDatabase, scope]() {
+                graphs[i] = symbolDatabase->getControlFlowGraph(scope);
+            });
+        }
+        TaskPool::run(4, tasks);
+
+        ASSERT(graphs[0] != nullptr);
+        for (const ControlFlowGraph *graph : graphs)
+            ASSERT_EQUALS(true, graph == graphs[0]);
+    }
+};
+
+REGISTER_TEST(TestControlFlow)
@@ -19,11 +19,17 @@
 #include "check.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
+#include "settings.h"
 #include "testsuite.h"
+#include "tokenize.h"
 
 #include <algorithm>
 #include <list>
+#include <map>
+#include <set>
+#include <sstream>
 #include <string>
+#include <vector>
 
 
 class TestCppcheck : public TestFixture {
@@ -45,10 +51,19 @@ private:
         }
     };
 
+    Settings settings;
+
     void run() override {
+        settings.addEnabled("all");
+        settings.inconclusive = true;
+        LOAD_LIB_2(settings.library, "std.cfg");
+
         TEST_CASE(instancesSorted);
         TEST_CASE(classInfoFormat);
         TEST_CASE(getErrorMessages);
+        TEST_CASE(concurrentChecks);
+        TEST_CASE(reportedIdsAreListed);
+        TEST_CASE(triggerNames);
     }
 
     void instancesSorted() const {
@@ -105,6 +120,171 @@ private:
         ASSERT(foundPurgedConfiguration);
         ASSERT(foundTooManyConfigs);
     }
+
+    std::list<std::string> checkWithThreads(const char code[], unsigned int threads) const {
+        ErrorLogger2 errorLogger;
+        CppCheck cppCheck(errorLogger, true);
+        cppCheck.settings().addEnabled("style");
+        cppCheck.settings().threads = threads;
+        cppCheck.check("test.cpp", code);
+        return errorLogger.id;
+    }
+
+    void concurrentChecks() const {
+        const char code[] = "void f(int *p) {\n"
+                            "  char a[10];\n"
+                            "  a[10] = 0;\n"
+                            "  int x;\n"
+                            "  *p = x;\n"
+                            "  if (p) {}\n"
+                            "  char *q = new char[10];\n"
+                            "}\n"
+                            "void g(int i) {\n"
+                            "  if (i == 1) {}\n"
+                            "  else if (i == 1) {}\n"
+                            "}\n";
+        const std::list<std::string> serial = checkWithThreads(code, 1);
+        ASSERT(serial.size() >= 4);
+        ASSERT(serial == checkWithThreads(code, 4));
+    }
+
+    class SeverityCollector : public ErrorLogger {
+    public:
+        std::map<std::string, std::set<Severity::SeverityType> > severities;
+
+        void reportOut(const std::string & /*outmsg*/) {
+        }
+
+        void reportErr(const ErrorLogger::ErrorMessage &msg) {
+            severities[msg._id].insert(msg._severity);
+        }
+    };
+
+    // A check is only run if one of the messages that its getErrorMessages()
+    // lists is shown, see CppCheck::selectAnalyses()
+    std::string unlistedIds(const char code[], const char filename[]) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, filename);
+
+        std::string unlisted;
+        for (const Check *check : Check::instances()) {
+            SeverityCollector listed;
+            check->getErrorMessages(&listed, &settings);
+            std::set<Severity::SeverityType> listedSeverities;
+            for (std::map<std::string, std::set<Severity::SeverityType> >::const_iterator it = listed.severities.begin(); it != listed.severities.end(); ++it)
+                listedSeverities.insert(it->second.begin(), it->second.end());
+
+            SeverityCollector reported;
+            TokenVisitor *visitor = check->createTokenVisitor(&tokenizer, &settings, &reported);
+            if (visitor) {
+                TokenVisitor::walk(&tokenizer, std::vector<TokenVisitor *>(1, visitor));
+                delete visitor;
+            } else {
+                const_cast<Check *>(check)->runChecks(&tokenizer, &settings, &reported);
+            }
+
+            for (std::map<std::string, std::set<Severity::SeverityType> >::const_iterator it = reported.severities.begin(); it != reported.severities.end(); ++it) {
+                if (listed.severities.find(it->first) == listed.severities.end()) {
+                    unlisted += check->name() + ": " + it->first + '\n';
+                    continue;
+                }
+                // the check must not be skipped when a message with this severity is shown
+                for (Severity::SeverityType severity : it->second) {
+                    if (listedSeverities.find(severity) == listedSeverities.end() && listedSeverities.find(Severity::error) == listedSeverities.end())
+                        unlisted += check->name() + ": " + it->first + " (" + Severity::toString(severity) + ")\n";
+                }
+            }
+        }
+        return unlisted;
+    }
+
+    void reportedIdsAreListed() {
+        ASSERT_EQUALS("", unlistedIds("void f() {\n"
+                                      "    char *x = alloca(10);\n"
+                                      "}", "test.c"));
+        ASSERT_EQUALS("", unlistedIds("void f(int a, int b) {\n"
+                                      "    int i = a + b;\n"
+                                      "    int j = a + b;\n"
+                                      "    g(i, j);\n"
+                                      "}", "test.cpp"));
+        ASSERT_EQUALS("", unlistedIds("void f(std::vector<int> &v) {\n"
+                                      "    v[-11] = 123;\n"
+                                      "}", "test.cpp"));
+        ASSERT_EQUALS("", unlistedIds("class Fred {\n"
+                                      "private:\n"
+                                      "    Fred(int) {}\n"
+                                      "    int x;\n"
+                                      "public:\n"
+                                      "    Fred() : x(0) {}\n"
+                                      "};", "test.cpp"));
+        ASSERT_EQUALS("", unlistedIds("int f(int x) {\n"
+                                      "    if (x == 0x7fffffff) {}\n"
+                                      "    return x + 1;\n"
+                                      "}", "test.c"));
+        ASSERT_EQUALS("", unlistedIds("void f(char *p) {\n"
+                                      "    char *q = p + 1;\n"
+                                      "    if (!p) {}\n"
+                                      "}", "test.c"));
+        ASSERT_EQUALS("", unlistedIds("void f() {\n"
+                                      "    char s[10];\n"
+                                      "    scanf(\"%5s\", s);\n"
+                                      "    int x;\n"
+                                      "    printf(\"%s\", x);\n"
+                                      "}", "test.c"));
+        ASSERT_EQUALS("", unlistedIds("void f(int *p, int i) {\n"
+                                      "    char a[10];\n"
+                                      "    a[10] = 0;\n"
+                                      "    int x;\n"
+                                      "    *p = x;\n"
+                                      "    if (p) {}\n"
+                                      "    char *q = new char[10];\n"
+                                      "    if (i == 1) {}\n"
+                                      "    else if (i == 1) {}\n"
+                                      "    i = 1 << 40;\n"
+                                      "}", "test.cpp"));
+    }
+
+    void triggerNames() const {
+        const Check *vaarg = nullptr;
+        const Check *io = nullptr;
+        for (const Check *check : Check::instances()) {
+            if (check->name() == "Vaarg")
+                vaarg = check;
+            else if (check->name() == "IO using format string")
+                io = check;
+        }
+        ASSERT(vaarg != nullptr);
+        ASSERT(io != nullptr);
+
+        ErrorLogger2 errorLogger;
+        CppCheck cppCheck(errorLogger, true);
+        cppCheck.selectAnalyses();
+
+        Tokenizer tokenizer1(&settings, nullptr);
+        std::istringstream istr1("void f(int x, ...) { g(x); }");
+        tokenizer1.tokenize(istr1, "test.cpp");
+        ASSERT_EQUALS(true, cppCheck.isCheckSkipped(vaarg, tokenizer1));
+
+        Tokenizer tokenizer2(&settings, nullptr);
+        std::istringstream istr2("void f(int x, ...) { va_list ap; va_start(ap, x); }");
+        tokenizer2.tokenize(istr2, "test.cpp");
+        ASSERT_EQUALS(false, cppCheck.isCheckSkipped(vaarg, tokenizer2));
+
+        // the check still reports its errors
+        cppCheck.check("test.cpp", "void f(int x, ...) { va_list ap; va_start(ap, x); }");
+        ASSERT(std::find(errorLogger.id.begin(), errorLogger.id.end(), "va_end_missing") != errorLogger.id.end());
+
+        // file functions trigger CheckIO without any FILE or printf token
+        Tokenizer tokenizer3(&settings, nullptr);
+        std::istringstream istr3("void f(void) { fflush(stdin); }");
+        tokenizer3.tokenize(istr3, "test.c");
+        ASSERT_EQUALS(false, cppCheck.isCheckSkipped(io, tokenizer3));
+
+        cppCheck.settings().addEnabled("portability");
+        cppCheck.check("test.c", "void f(void) { fflush(stdin); }");
+        ASSERT(std::find(errorLogger.id.begin(), errorLogger.id.end(), "fflushOnInputStream") != errorLogger.id.end());
+    }
 };
 
 REGISTER_TEST(TestCppcheck)
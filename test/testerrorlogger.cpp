@@ -19,6 +19,7 @@
 #include "config.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
+#include "mathlib.h"
 #include "suppressions.h"
 #include "testsuite.h"
 
@@ -57,6 +58,7 @@ private:
         TEST_CASE(SerializeInconclusiveMessage);
         TEST_CASE(DeserializeInvalidInput);
         TEST_CASE(SerializeSanitize);
+        TEST_CASE(SerializeLocations);
 
         TEST_CASE(suppressUnmatchedSuppressions);
     }
@@ -288,6 +290,24 @@ private:
         ASSERT_EQUALS("Illegal character in \"foo\\001bar\"", msg2.verboseMessage());
     }
 
+    void SerializeLocations() const {
+        std::list<ErrorLogger::ErrorMessage::FileLocation> locs;
+        locs.emplace_back("foo.cpp", "first", 5U);
+        locs.emplace_back("bar.h", "second", 8U);
+        locs.emplace_back("foo.cpp", emptyString, 2U);
+        ErrorMessage msg(locs, emptyString, Severity::error, "Programming error", "errorId", false);
+
+        // the locations are read back in the same order
+        ErrorMessage msg2;
+        msg2.deserialize(msg.serialize());
+        ASSERT_EQUALS(3U, msg2._callStack.size());
+        std::string locations;
+        for (const ErrorLogger::ErrorMessage::FileLocation &loc : msg2._callStack)
+            locations += loc.getfile() + ':' + MathLib::toString(loc.line) + ':' + loc.getinfo() + ' ';
+        ASSERT_EQUALS("foo.cpp:5:first bar.h:8:second foo.cpp:2: ", locations);
+        ASSERT_EQUALS(msg.serialize(), msg2.serialize());
+    }
+
     void suppressUnmatchedSuppressions() {
         std::list<Suppressions::Suppression> suppressions;
 
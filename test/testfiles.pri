@@ -4,6 +4,7 @@ INCLUDEPATH += ../externals/tinyxml
 
 
 SOURCES += $${BASEPATH}/test64bit.cpp \
+           $${BASEPATH}/testanalyzerinfo.cpp \
            $${BASEPATH}/testassert.cpp \
            $${BASEPATH}/testastutils.cpp \
            $${BASEPATH}/testautovariables.cpp \
@@ -11,10 +12,13 @@ SOURCES += $${BASEPATH}/test64bit.cpp \
            $${BASEPATH}/testboost.cpp \
            $${BASEPATH}/testbufferoverrun.cpp \
            $${BASEPATH}/testcharvar.cpp \
+           $${BASEPATH}/testcheck.cpp \
+           $${BASEPATH}/testchunkedlist.cpp \
            $${BASEPATH}/testclass.cpp \
            $${BASEPATH}/testcmdlineparser.cpp \
            $${BASEPATH}/testcondition.cpp \
            $${BASEPATH}/testconstructors.cpp \
+           $${BASEPATH}/testcontrolflow.cpp \
            $${BASEPATH}/testcppcheck.cpp \
            $${BASEPATH}/testerrorlogger.cpp \
            $${BASEPATH}/testexceptionsafety.cpp \
@@ -46,8 +50,10 @@ SOURCES += $${BASEPATH}/test64bit.cpp \
            $${BASEPATH}/teststl.cpp \
            $${BASEPATH}/teststring.cpp \
            $${BASEPATH}/testsuite.cpp \
+           $${BASEPATH}/testsummaries.cpp \
            $${BASEPATH}/testsuppressions.cpp \
            $${BASEPATH}/testsymboldatabase.cpp \
+           $${BASEPATH}/testtaskpool.cpp \
            $${BASEPATH}/testthreadexecutor.cpp \
            $${BASEPATH}/testtimer.cpp \
            $${BASEPATH}/testtoken.cpp \
@@ -266,10 +266,6 @@ private:
         }
 
         tokenizer.simplifyTokenList2();
-        // call all "runSimplifiedChecks" in all registered Check classes
-        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
-            (*it)->runSimplifiedChecks(&tokenizer, &settings, this);
-        }
 
         return tokenizer.tokens()->stringifyList(false, false, false, true, false, 0, 0);
     }
@@ -851,7 +847,7 @@ private:
         ASSERT_THROW(checkCode("A( ) { } bool f( ) { ( ) F; ( ) { ( == ) if ( !=< || ( !A( ) && r[2] ) ) ( !A( ) ) ( ) } }"), InternalError);
     }
 
-    void garbageCode109() { //  #6900 "segmentation fault (invalid code) in CheckStl::runSimplifiedChecks"
+    void garbageCode109() { //  #6900 "segmentation fault (invalid code)"
         checkCode("( *const<> (( ) ) { } ( *const ( ) ( ) ) { } ( * const<> ( size_t )) ) { } ( * const ( ) ( ) ) { }");
     }
 
@@ -153,13 +153,12 @@ private:
         Tokenizer tokenizer(&settings, this);
         std::istringstream istr(code);
         tokenizer.tokenize(istr, cpp?"test.cpp":"test.c");
-        tokenizer.simplifyTokenList2();
 
         // Check for leaks..
         CheckLeakAutoVar c;
         settings.checkLibrary = true;
         settings.addEnabled("information");
-        c.runSimplifiedChecks(&tokenizer, &settings, this);
+        c.runChecks(&tokenizer, &settings, this);
     }
 
     void assign1() {
@@ -1597,11 +1596,10 @@ private:
         Tokenizer tokenizer(&settings, this);
         std::istringstream istr(code);
         tokenizer.tokenize(istr, "test.c");
-        tokenizer.simplifyTokenList2();
 
         // Check for leaks..
         CheckLeakAutoVar checkLeak;
-        checkLeak.runSimplifiedChecks(&tokenizer, &settings, this);
+        checkLeak.runChecks(&tokenizer, &settings, this);
     }
 
     void run() override {
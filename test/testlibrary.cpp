@@ -52,6 +52,7 @@ private:
         TEST_CASE(function_arg_valid);
         TEST_CASE(function_arg_minsize);
         TEST_CASE(function_namespace);
+        TEST_CASE(function_resolved);
         TEST_CASE(function_method);
         TEST_CASE(function_baseClassMethod); // calling method in base class
         TEST_CASE(function_warn);
@@ -62,6 +63,7 @@ private:
         TEST_CASE(podtype);
         TEST_CASE(container);
         TEST_CASE(version);
+        TEST_CASE(binary);
         TEST_CASE(loadLibErrors);
     }
 
@@ -483,6 +485,35 @@ private:
         }
     }
 
+    void function_resolved() const {
+        const char xmldata[] = "<?xml version=\"1.0\"?>\n"
+                               "<def>\n"
+                               "  <function name=\"Foo::foo\">\n"
+                               "    <noreturn>false</noreturn>\n"
+                               "  </function>\n"
+                               "</def>";
+
+        Settings s;
+        ASSERT_EQUALS(true, Library::OK == (readLibrary(s.library, xmldata)).errorcode);
+
+        Tokenizer tokenizer(&s, nullptr);
+        std::istringstream istr("void f() { Foo::foo(); }");
+        tokenizer.tokenize(istr, "test.cpp");
+
+        // The name is resolved once during tokenizing
+        Token *tok = const_cast<Token *>(Token::findsimplematch(tokenizer.tokens(), "foo ("));
+        ASSERT(tok->libraryFunction() != nullptr);
+        ASSERT_EQUALS("Foo::foo", s.library.getFunctionName(tok));
+        ASSERT(s.library.isnotnoreturn(tok));
+        ASSERT(tokenizer.tokens()->libraryFunction() == nullptr);
+
+        // .. and forgotten when the token changes
+        tok->str("bar");
+        ASSERT(tok->libraryFunction() == nullptr);
+        ASSERT_EQUALS("Foo::bar", s.library.getFunctionName(tok));
+        ASSERT(!s.library.isnotnoreturn(tok));
+    }
+
     void function_method() const {
         const char xmldata[] = "<?xml version=\"1.0\"?>\n"
                                "<def>\n"
@@ -813,6 +844,63 @@ private:
         }
     }
 
+    void binary() const {
+        const char xmldata[] = "<?xml version=\"1.0\"?>\n"
+                               "<def>\n"
+                               "  <memory>\n"
+                               "    <alloc>CreateX</alloc>\n"
+                               "    <dealloc arg=\"2\">DeleteX</dealloc>\n"
+                               "  </memory>\n"
+                               "  <function name=\"foo\">\n"
+                               "    <noreturn>false</noreturn>\n"
+                               "    <returnValue type=\"int\">arg1</returnValue>\n"
+                               "    <arg nr=\"1\"><not-uninit/><valid>1:</valid></arg>\n"
+                               "    <arg nr=\"2\"><minsize type=\"mul\" arg=\"3\" arg2=\"4\"/></arg>\n"
+                               "    <warn severity=\"style\" reason=\"Obsolete\" alternatives=\"bar\"/>\n"
+                               "  </function>\n"
+                               "  <podtype name=\"u8\" sign=\"u\" size=\"1\"/>\n"
+                               "  <platformtype name=\"DWORD\" value=\"long\"><unsigned/></platformtype>\n"
+                               "  <container id=\"A\" startPattern=\"std :: A &lt;\">\n"
+                               "    <size><function name=\"size\" yields=\"size\"/></size>\n"
+                               "  </container>\n"
+                               "  <define name=\"X\" value=\"1\"/>\n"
+                               "</def>";
+
+        Library library;
+        ASSERT_EQUALS(true, library.loadxmldata(xmldata, sizeof(xmldata)));
+        const std::string data = library.saveBinary();
+
+        Library copy;
+        ASSERT_EQUALS(true, copy.loadBinary(data));
+        ASSERT_EQUALS(data, copy.saveBinary());
+        ASSERT_EQUALS(library.allocId("CreateX"), copy.allocId("CreateX"));
+        ASSERT_EQUALS(2, copy.dealloc("DeleteX")->arg);
+        ASSERT_EQUALS(true, copy.hasminsize("foo"));
+        ASSERT_EQUALS("Obsolete function 'foo' called. It is recommended to use 'bar' instead.", copy.functionwarn["foo"].message);
+        ASSERT_EQUALS(1U, copy.podtype("u8")->size);
+        ASSERT_EQUALS(true, copy.platform_type("DWORD", "")->_unsigned);
+        ASSERT_EQUALS(Library::Container::SIZE, copy.containers["A"].getYield("size"));
+        ASSERT_EQUALS(1U, copy.defines.size());
+
+        // Argument checks are read when a token list uses the function
+        Library lazy;
+        ASSERT_EQUALS(true, lazy.loadBinary(data));
+        ASSERT_EQUALS(true, lazy.functions["foo"].argumentChecks.empty());
+        TokenList tokenList(nullptr);
+        std::istringstream istr("bar(1); foo(1, 2);");
+        tokenList.createTokens(istr);
+        tokenList.summarizeNames();
+        lazy.loadFunctions(tokenList);
+        ASSERT_EQUALS("1:", lazy.functions["foo"].argumentChecks[1].valid);
+        ASSERT_EQUALS(4, lazy.functions["foo"].argumentChecks[2].minsizes[0].arg2);
+        ASSERT_EQUALS(data, lazy.saveBinary());
+
+        // Truncated or modified data is rejected and the library is not changed
+        ASSERT_EQUALS(false, copy.loadBinary(data.substr(0, data.size() - 1)));
+        ASSERT_EQUALS(false, copy.loadBinary("cppcheck-cfg"));
+        ASSERT_EQUALS(data, copy.saveBinary());
+    }
+
     void loadLibError(const char xmldata [], Library::ErrorCode errorcode, const char* file, unsigned line) const {
         Library library;
         assertEquals(file, line, errorcode, readLibrary(library, xmldata).errorcode);
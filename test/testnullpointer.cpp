@@ -124,10 +124,6 @@ private:
         // Check for null pointer dereferences..
         CheckNullPointer checkNullPointer;
         checkNullPointer.runChecks(&tokenizer, &settings, this);
-
-        tokenizer.simplifyTokenList2();
-
-        checkNullPointer.runSimplifiedChecks(&tokenizer, &settings, this);
     }
 
     void checkP(const char code[]) {
@@ -154,10 +150,6 @@ private:
         // Check for null pointer dereferences..
         CheckNullPointer checkNullPointer;
         checkNullPointer.runChecks(&tokenizer, &settings, this);
-
-        tokenizer.simplifyTokenList2();
-
-        checkNullPointer.runSimplifiedChecks(&tokenizer, &settings, this);
     }
 
 
@@ -1402,8 +1394,9 @@ private:
               "    }\n"
               "    return p;\n"
               "}", true);
-        ASSERT_EQUALS("[test.cpp:7]: (warning) Possible null pointer dereference: p\n"
-                      "[test.cpp:7]: (error) Null pointer dereference\n", errout.str());
+        TODO_ASSERT_EQUALS("[test.cpp:7]: (warning) Possible null pointer dereference: p\n"
+                           "[test.cpp:7]: (error) Null pointer dereference\n",
+                           "[test.cpp:7]: (warning) Possible null pointer dereference: p\n", errout.str());
     }
 
     void nullpointer_cast() { // #4692
@@ -1814,6 +1807,11 @@ private:
               "    typeof(*NULL) y;\n"
               "}", true);
         ASSERT_EQUALS("", errout.str());
+
+        check("void f() {\n"
+              "    strcpy((char*)0, \"abc\");\n"
+              "}");
+        ASSERT_EQUALS("[test.cpp:2]: (error) Null pointer dereference\n", errout.str());
     }
 
     void gcc_statement_expression() {
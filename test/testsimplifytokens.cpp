@@ -201,6 +201,9 @@ private:
         // remove calling convention __cdecl, __stdcall, ...
         TEST_CASE(simplifyCallingConvention);
 
+        // peephole rules are fused into one pass
+        TEST_CASE(peepholeRules);
+
         TEST_CASE(simplifyFunctorCall);
 
         TEST_CASE(simplifyFunctionPointer); // ticket #5339 (simplify function pointer after comma)
@@ -3311,6 +3314,31 @@ private:
         ASSERT_EQUALS("enum E { CALLBACK } ;", tok("enum E { CALLBACK } ;", true, Settings::Unix32));
     }
 
+    std::string tokPeephole(const char code[], Settings::PlatformType type = Settings::Native) {
+        errout.str("");
+
+        Settings settings;
+        settings.debugPeephole = true;
+        settings.platform(type);
+        Tokenizer tokenizer(&settings, this);
+
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+
+        return tokenizer.tokens()->stringifyList(0, false);
+    }
+
+    void peepholeRules() {
+        // --debug-peephole throws if the fused pass differs from the separate passes
+        ASSERT_EQUALS("int f ( ) ;", tokPeephole("int __declspec(dllexport) __stdcall f(void);"));
+        ASSERT_EQUALS("int f ( ) ;", tokPeephole("int __stdcall __declspec(noreturn) __cdecl f();"));
+        ASSERT_EQUALS("int f ( ) ;", tokPeephole("int WINAPI __declspec(dllexport) f();", Settings::Win32A));
+        ASSERT_EQUALS("void f ( int & & ) ; x = a - 1 ; y = a + 1 ; z = a [ 1 ] ;",
+                      tokPeephole("void f(int &&); x = a + -1; y = a - -1; z = 1[a];"));
+        ASSERT_EQUALS("void f ( ) { memset ( d , 0 , n ) ; strcpy ( d , \"a\" ) ; }",
+                      tokPeephole("void f() { ZeroMemory(d, n); _tcscpy(d, _T(\"a\")); }", Settings::Win32A));
+    }
+
     void simplifyFunctorCall() {
         ASSERT_EQUALS("IncrementFunctor ( ) ( a ) ;", tok("IncrementFunctor()(a);", true));
     }
@@ -0,0 +1,201 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "checknullpointer.h"
+#include "settings.h"
+#include "summaries.h"
+#include "testsuite.h"
+#include "token.h"
+#include "tokenize.h"
+
+#include <list>
+#include <set>
+#include <sstream>
+#include <string>
+
+class TestSummaries : public TestFixture {
+public:
+    TestSummaries() : TestFixture("TestSummaries") {
+    }
+
+private:
+
+    void run() override {
+        TEST_CASE(create);
+        TEST_CASE(overloads);
+        TEST_CASE(usedSummaries);
+        TEST_CASE(merge);
+        TEST_CASE(replace);
+        TEST_CASE(noreturn);
+        TEST_CASE(returnValue);
+        TEST_CASE(derefArgument);
+    }
+
+    std::string create(const char code[]) {
+        Settings settings;
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.c");
+        return Summaries::create(&tokenizer, &settings);
+    }
+
+    void create() {
+        ASSERT_EQUALS("f/1 return:-1,0\n", create("int f(int x) { if (x) return -1; return 0; }"));
+        ASSERT_EQUALS("f/1\n", create("int f(int x) { return x; }"));
+        ASSERT_EQUALS("f/0 noreturn\n", create("void f() { exit(1); }"));
+        ASSERT_EQUALS("f/2 deref:2\n", create("void f(int *p, int *q) { *q = 0; }"));
+        ASSERT_EQUALS("f/1 deref:1\n", create("int f(int *p) { return p[1]; }"));
+        ASSERT_EQUALS("f/1\n", create("void f(int *p) { if (p) { *p = 0; } }"));
+        ASSERT_EQUALS("f/1\n", create("void f(int *p) { p = 0; *p = 0; }"));
+        ASSERT_EQUALS("f/1\n", create("void f(int *p) { int x = sizeof(*p); }"));
+        ASSERT_EQUALS("", create("static int f() { return 0; }"));
+        ASSERT_EQUALS("", create("struct S { int f() { return 0; } };"));
+        ASSERT_EQUALS("", create("int f(const char *fmt, ...) { return 0; }"));
+    }
+
+    std::string createCpp(const char code[]) {
+        Settings settings;
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        return Summaries::create(&tokenizer, &settings);
+    }
+
+    void overloads() {
+        ASSERT_EQUALS("f/1 return:0\nf/2 return:1\n", createCpp("int f(int x) { return 0; }\n"
+                      "int f(int x, int y) { return 1; }"));
+        ASSERT_EQUALS("g/0 return:2\n", createCpp("int f(int x) { return 0; }\n"
+                      "int f(char x) { return 1; }\n"
+                      "int g() { return 2; }"));
+
+        // Only calls of global functions without a body are looked up
+        Settings settings;
+        settings.summaries.setSummaries("a.a1", "f/1 return:0\nf/2 return:1\n");
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("int f(int);\n"
+                                "int f(int, int);\n"
+                                "struct S { int f(int); };\n"
+                                "void g(S *s) { a = f(1); b = f(1,2); c = s->f(1); d = f(); }");
+        tokenizer.tokenize(istr, "test.cpp");
+        Summaries::Function summary;
+        const Token *tok = Token::findsimplematch(tokenizer.tokens(), "a = f (");
+        ASSERT_EQUALS(true, settings.summaries.find(tok->tokAt(2), &summary));
+        ASSERT_EQUALS(0, *summary.returnValues.begin());
+        tok = Token::findsimplematch(tok, "b = f (");
+        ASSERT_EQUALS(true, settings.summaries.find(tok->tokAt(2), &summary));
+        ASSERT_EQUALS(1, *summary.returnValues.begin());
+        tok = Token::findsimplematch(tok, "c = s . f (");
+        ASSERT_EQUALS(false, settings.summaries.find(tok->tokAt(4), &summary));
+        tok = Token::findsimplematch(tok, "d = f (");
+        ASSERT_EQUALS(false, settings.summaries.find(tok->tokAt(2), &summary));
+    }
+
+    void usedSummaries() {
+        Summaries summaries;
+        summaries.setSummaries("a.a1", "f/1 return:0\ng/0 noreturn\n");
+        summaries.setSummaries("b.a1", "f/1 return:1\n");
+        std::set<std::string> functionNames;
+        functionNames.insert("f");
+        functionNames.insert("h");
+        ASSERT_EQUALS("f/1 return:0,1\n", summaries.getSummaries(functionNames));
+        summaries.setSummaries("b.a1", "");
+        ASSERT_EQUALS("f/1 return:0\n", summaries.getSummaries(functionNames));
+    }
+
+    void merge() {
+        Summaries summaries;
+        summaries.setSummaries("a.a1", "f/2 noreturn return:0 deref:1,2\n");
+        summaries.setSummaries("b.a1", "f/2 noreturn return:1 deref:2\n");
+
+        Summaries::Function summary;
+        ASSERT_EQUALS(false, summaries.find("g", 2, &summary));
+        ASSERT_EQUALS(false, summaries.find("f", 1, &summary));
+        ASSERT_EQUALS(true, summaries.find("f", 2, &summary));
+        ASSERT_EQUALS(true, summary.noreturn);
+        ASSERT_EQUALS(2U, summary.returnValues.size());
+        ASSERT_EQUALS(1U, summary.derefArgs.size());
+        ASSERT_EQUALS(2U, *summary.derefArgs.begin());
+
+        summaries.setSummaries("c.a1", "f/2\n");
+        ASSERT_EQUALS(true, summaries.find("f", 2, &summary));
+        ASSERT_EQUALS(false, summary.noreturn);
+        ASSERT_EQUALS(0U, summary.returnValues.size());
+        ASSERT_EQUALS(0U, summary.derefArgs.size());
+    }
+
+    void replace() {
+        Summaries summaries;
+        summaries.setSummaries("a.a1", "f/0 return:0\n");
+        summaries.setSummaries("a.a1", "g/0 return:1\n");
+
+        Summaries::Function summary;
+        ASSERT_EQUALS(false, summaries.find("f", 0, &summary));
+        ASSERT_EQUALS(true, summaries.find("g", 0, &summary));
+        ASSERT_EQUALS(1, *summary.returnValues.begin());
+
+        summaries.setSummaries("a.a1", "");
+        ASSERT_EQUALS(false, summaries.find("g", 0, &summary));
+    }
+
+    void noreturn() {
+        Settings settings;
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("void f() { if (x) { a(); } if (y) { b(); } }");
+        tokenizer.tokenize(istr, "test.c");
+        const Token *end1 = Token::findsimplematch(tokenizer.tokens(), "a")->tokAt(4);
+        const Token *end2 = Token::findsimplematch(tokenizer.tokens(), "b")->tokAt(4);
+
+        std::string unknownFunc;
+        ASSERT_EQUALS(true, settings.summaries.isScopeNoReturn(end1, settings.library, &unknownFunc));
+        ASSERT_EQUALS("a", unknownFunc);
+
+        settings.summaries.setSummaries("a.a1", "a/0\nb/0 noreturn\n");
+        ASSERT_EQUALS(false, settings.summaries.isScopeNoReturn(end1, settings.library, &unknownFunc));
+        ASSERT_EQUALS("", unknownFunc);
+        ASSERT_EQUALS(true, settings.summaries.isScopeNoReturn(end2, settings.library, &unknownFunc));
+        ASSERT_EQUALS("", unknownFunc);
+    }
+
+    void returnValue() {
+        Settings settings;
+        settings.summaries.setSummaries("a.a1", "zero/0 return:0\n");
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("int zero();\n"
+                                "int f() { return zero(); }");
+        tokenizer.tokenize(istr, "test.c");
+        const Token *tok = Token::findsimplematch(tokenizer.tokens(), "return zero ( ) ;");
+        ASSERT_EQUALS(true, tok && tok->tokAt(2)->hasKnownIntValue());
+        ASSERT_EQUALS(0, tok->tokAt(2)->values().front().intvalue);
+    }
+
+    void derefArgument() {
+        Settings settings;
+        settings.summaries.setSummaries("a.a1", "x/3 deref:2\n");
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("void f() { int a,b,c; x(a,b,c); }");
+        tokenizer.tokenize(istr, "test.c");
+        const Token *xtok = Token::findsimplematch(tokenizer.tokens(), "x");
+
+        std::list<const Token *> null;
+        CheckNullPointer::parseFunctionCall(*xtok, null, &settings.library, &settings.summaries);
+        ASSERT_EQUALS(1U, null.size());
+        ASSERT_EQUALS("b", null.front()->str());
+    }
+};
+
+REGISTER_TEST(TestSummaries)
@@ -64,6 +64,7 @@ private:
         TEST_CASE(unusedFunction);
 
         TEST_CASE(matchglob);
+        TEST_CASE(suppressedEverywhere);
     }
 
     void suppressionsBadId1() const {
@@ -583,6 +584,25 @@ private:
         ASSERT_EQUALS(true, Suppressions::matchglob("?y?", "xyz"));
         ASSERT_EQUALS(true, Suppressions::matchglob("?/?/?", "x/y/z"));
     }
+
+    void suppressedEverywhere() {
+        Suppressions suppressions;
+        std::istringstream s1("abc\n"
+                              "def:test.cpp\n"
+                              "ghi:*:12\n"
+                              "jkl:*\n");
+        ASSERT_EQUALS("", suppressions.parseFile(s1));
+        ASSERT_EQUALS(true, suppressions.isSuppressedEverywhere("abc"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("def"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("ghi"));
+        ASSERT_EQUALS(true, suppressions.isSuppressedEverywhere("jkl"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("xyz"));
+
+        Suppressions all;
+        std::istringstream s2("*\n");
+        ASSERT_EQUALS("", all.parseFile(s2));
+        ASSERT_EQUALS(true, all.isSuppressedEverywhere("xyz"));
+    }
 };
 
 REGISTER_TEST(TestSuppressions)
@@ -28,6 +28,7 @@
 
 #include <climits>
 #include <cstddef>
+#include <limits>
 #include <list>
 #include <map>
 #include <set>
@@ -75,7 +76,7 @@ private:
     }
 
     static const Scope *findFunctionScopeByToken(const SymbolDatabase * db, const Token *tok) {
-        std::list<Scope>::const_iterator scope;
+        ChunkedList<Scope>::const_iterator scope;
 
         for (scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
             if (scope->type == Scope::eFunction) {
@@ -95,7 +96,7 @@ private:
                 currScope = currScope->nestedIn;
         }
         while (currScope) {
-            for (std::list<Function>::const_iterator i = currScope->functionList.begin(); i != currScope->functionList.end(); ++i) {
+            for (ChunkedList<Function>::const_iterator i = currScope->functionList.begin(); i != currScope->functionList.end(); ++i) {
                 if (i->tokenDef->str() == str)
                     return &*i;
             }
@@ -217,6 +218,7 @@ private:
         TEST_CASE(namespaces2);
         TEST_CASE(namespaces3);  // #3854 - unknown macro
         TEST_CASE(namespaces4);
+        TEST_CASE(namespaces5);
 
         TEST_CASE(tryCatch1);
 
@@ -354,6 +356,7 @@ private:
         TEST_CASE(executableScopeWithUnknownFunction);
 
         TEST_CASE(valuetype);
+        TEST_CASE(valuetypeThreads);
 
         TEST_CASE(variadic1); // #7453
         TEST_CASE(variadic2); // #7649
@@ -1370,8 +1373,8 @@ private:
 
         if (db) {
             bool seen_something = false;
-            for (std::list<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
-                for (std::list<Function>::const_iterator func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
+            for (ChunkedList<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
+                for (ChunkedList<Function>::const_iterator func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
                     ASSERT_EQUALS("Sub", func->token->str());
                     ASSERT_EQUALS(true, func->hasBody());
                     ASSERT_EQUALS(Function::eConstructor, func->type);
@@ -1644,10 +1647,10 @@ private:
 
         ASSERT(db && db->scopeList.size() == 1);
         if (db && db->scopeList.size() == 1) {
-            std::list<Scope>::const_iterator it = db->scopeList.begin();
+            ChunkedList<Scope>::const_iterator it = db->scopeList.begin();
             ASSERT(it->varlist.size() == 1);
             if (it->varlist.size() == 1) {
-                std::list<Variable>::const_iterator var = it->varlist.begin();
+                ChunkedList<Variable>::const_iterator var = it->varlist.begin();
                 ASSERT(var->name() == "i");
                 ASSERT(var->typeStartToken()->str() == "int");
             }
@@ -1659,10 +1662,10 @@ private:
 
         ASSERT(db && db->scopeList.size() == 1);
         if (db && db->scopeList.size() == 1) {
-            std::list<Scope>::const_iterator it = db->scopeList.begin();
+            ChunkedList<Scope>::const_iterator it = db->scopeList.begin();
             ASSERT(it->varlist.size() == 1);
             if (it->varlist.size() == 1) {
-                std::list<Variable>::const_iterator var = it->varlist.begin();
+                ChunkedList<Variable>::const_iterator var = it->varlist.begin();
                 ASSERT(var->name() == "array");
                 ASSERT(var->typeStartToken()->str() == "int");
             }
@@ -1674,10 +1677,10 @@ private:
 
         ASSERT(db && db->scopeList.size() == 1);
         if (db && db->scopeList.size() == 1) {
-            std::list<Scope>::const_iterator it = db->scopeList.begin();
+            ChunkedList<Scope>::const_iterator it = db->scopeList.begin();
             ASSERT(it->varlist.size() == 1);
             if (it->varlist.size() == 1) {
-                std::list<Variable>::const_iterator var = it->varlist.begin();
+                ChunkedList<Variable>::const_iterator var = it->varlist.begin();
                 ASSERT(var->name() == "array");
                 ASSERT(var->typeStartToken()->str() == "int");
             }
@@ -2021,7 +2024,7 @@ private:
         if (db) {
             ASSERT_EQUALS(3, db->scopeList.size());
             if (db->scopeList.size() == 3) {
-                std::list<Scope>::const_iterator scope = db->scopeList.begin();
+                ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
                 ++scope;
                 ASSERT_EQUALS((unsigned int)Scope::eClass, (unsigned int)scope->type);
                 ASSERT_EQUALS(1, scope->functionList.size());
@@ -2045,7 +2048,7 @@ private:
         if (db) {
             ASSERT_EQUALS(3, db->scopeList.size());
             if (db->scopeList.size() == 3) {
-                std::list<Scope>::const_iterator scope = db->scopeList.begin();
+                ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
                 ++scope;
                 ASSERT_EQUALS((unsigned int)Scope::eClass, (unsigned int)scope->type);
                 ASSERT_EQUALS(1, scope->functionList.size());
@@ -2142,7 +2145,7 @@ private:
 
         // Locate the scope for the class..
         const Scope *scope = nullptr;
-        for (std::list<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
+        for (ChunkedList<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
             if (it->isClassOrStruct()) {
                 scope = &(*it);
                 break;
@@ -2176,7 +2179,7 @@ private:
 
         // Locate the scope for the class..
         const Scope *scope = nullptr;
-        for (std::list<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
+        for (ChunkedList<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
             if (it->isClassOrStruct()) {
                 scope = &(*it);
                 break;
@@ -2214,6 +2217,26 @@ private:
         ASSERT_EQUALS(2U, fredAType->classDef->linenr());
     }
 
+    void namespaces5() { // function and struct with the same name
+        GET_SYMBOL_DB("namespace N {\n"
+                      "    void A() { }\n"
+                      "    struct A { void f(); };\n"
+                      "}\n"
+                      "void N::A::f() { }");
+        const Scope *ns = db->findScopeByName("N");
+        ASSERT(ns != nullptr);
+        if (!ns)
+            return;
+        const Scope *scope = ns->findRecordInNestedList("A");
+        ASSERT(scope != nullptr);
+        if (!scope)
+            return;
+        ASSERT_EQUALS(Scope::eStruct, scope->type);
+        ASSERT_EQUALS(Scope::eFunction, db->findScopeByName("A")->type);
+        ASSERT_EQUALS(1U, scope->functionList.size());
+        ASSERT_EQUALS(true, scope->functionList.front().hasBody());
+    }
+
     void tryCatch1() {
         const char str[] = "void foo() {\n"
                            "    try { }\n"
@@ -2465,7 +2488,7 @@ private:
 
         // Find the scope for the Fred struct..
         const Scope *fredScope = nullptr;
-        for (std::list<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
+        for (ChunkedList<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
             if (scope->isClassOrStruct() && scope->className == "Fred")
                 fredScope = &(*scope);
         }
@@ -2479,7 +2502,7 @@ private:
         // Get linenumbers where the bodies for the constructor and destructor are..
         unsigned int constructor = 0;
         unsigned int destructor = 0;
-        for (std::list<Function>::const_iterator it = fredScope->functionList.begin(); it != fredScope->functionList.end(); ++it) {
+        for (ChunkedList<Function>::const_iterator it = fredScope->functionList.begin(); it != fredScope->functionList.end(); ++it) {
             if (it->type == Function::eConstructor)
                 constructor = it->token->linenr();  // line number for constructor body
             if (it->type == Function::eDestructor)
@@ -2572,7 +2595,7 @@ private:
         ASSERT(db && db->typeList.size() == 5);
         if (!db || db->typeList.size() < 5)
             return;
-        std::list<Type>::const_iterator i = db->typeList.begin();
+        ChunkedList<Type>::const_iterator i = db->typeList.begin();
         const Type* Foo = &(*i++);
         const Type* Bar = &(*i++);
         const Type* Sub = &(*i++);
@@ -2641,7 +2664,7 @@ private:
         ASSERT(db && db->typeList.size() == 3);
         if (!db || db->typeList.size() != 3)
             return;
-        std::list<Type>::const_iterator i = db->typeList.begin();
+        ChunkedList<Type>::const_iterator i = db->typeList.begin();
         const Type* Fred = &(*i++);
         const Type* Wilma = &(*i++);
         const Type* Barney = &(*i++);
@@ -2731,7 +2754,7 @@ private:
             ASSERT(db->getVariableFromVarId(i) != nullptr);
 
         ASSERT_EQUALS(4U, db->scopeList.size());
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
         ASSERT_EQUALS(Scope::eGlobal, scope->type);
         ++scope;
         ASSERT_EQUALS(Scope::eStruct, scope->type);
@@ -2749,7 +2772,7 @@ private:
 
         ASSERT(db != nullptr);
         ASSERT_EQUALS(4U, db->scopeList.size());
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
         ASSERT_EQUALS(Scope::eGlobal, scope->type);
         ++scope;
         ASSERT_EQUALS(Scope::eStruct, scope->type);
@@ -2957,7 +2980,7 @@ private:
         if (db) {
             ASSERT(db->scopeList.size() == 4U);
             if (db->scopeList.size() == 4U) {
-                std::list<Scope>::const_iterator it = db->scopeList.begin();
+                ChunkedList<Scope>::const_iterator it = db->scopeList.begin();
                 ASSERT(it->type == Scope::eGlobal);
                 ASSERT((++it)->type == Scope::eFunction);
                 ASSERT((++it)->type == Scope::eIf);
@@ -2981,7 +3004,7 @@ private:
         if (db) {
             ASSERT(db->typeList.size() == 3U);
             if (db->typeList.size() == 3U) {
-                std::list<Type>::const_iterator it = db->typeList.begin();
+                ChunkedList<Type>::const_iterator it = db->typeList.begin();
                 const Type * classB = &(*it);
                 const Type * classC = &(*(++it));
                 const Type * classA = &(*(++it));
@@ -4031,7 +4054,7 @@ private:
         ASSERT_EQUALS(3U, db->scopeList.size());
 
         // Assert that all enum values are known
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
 
         // Offsets
         ++scope;
@@ -4120,7 +4143,7 @@ private:
         ASSERT_EQUALS(2U, db->scopeList.size());
 
         // Assert that all enum values are known
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
 
         ++scope;
         ASSERT_EQUALS((unsigned int)Scope::eEnum, (unsigned int)scope->type);
@@ -4374,7 +4397,7 @@ private:
                       "};");
         ASSERT(db && db->scopeList.back().functionList.size() == 4);
         if (db && db->scopeList.back().functionList.size() == 4) {
-            std::list<Function>::const_iterator it = db->scopeList.back().functionList.begin();
+            ChunkedList<Function>::const_iterator it = db->scopeList.back().functionList.begin();
             ASSERT((it++)->isPure());
             ASSERT((it++)->isPure());
             ASSERT(!(it++)->isPure());
@@ -5547,7 +5570,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 3);
         if (db && db->scopeList.size() == 3) {
-            std::list<Scope>::const_iterator scope = db->scopeList.begin();
+            ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
             ASSERT_EQUALS(Scope::eGlobal, scope->type);
             ++scope;
             ASSERT_EQUALS(Scope::eFunction, scope->type);
@@ -5568,7 +5591,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 3);
         if (db && db->scopeList.size() == 3) {
-            std::list<Scope>::const_iterator scope = db->scopeList.begin();
+            ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
             ASSERT_EQUALS(Scope::eGlobal, scope->type);
             ++scope;
             ASSERT_EQUALS(Scope::eFunction, scope->type);
@@ -5600,7 +5623,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 3);
         if (db && db->scopeList.size() == 3) {
-            std::list<Scope>::const_iterator scope = db->scopeList.begin();
+            ChunkedList<Scope>::const_iterator scope = db->scopeList.begin();
             ASSERT_EQUALS(Scope::eGlobal, scope->type);
             ++scope;
             ASSERT_EQUALS(Scope::eClass, scope->type);
@@ -5625,6 +5648,18 @@ private:
         return tok->valueType() ? tok->valueType()->str() : std::string();
     }
 
+    void valuetypeThreads() {
+        Settings s;
+        s.threads = 4;
+        const char code[] = "struct A { int x; };\n"
+                            "double f1(double d) { return d * 2; }\n"
+                            "int f2(A *p) { return p->x + 1L; }\n"
+                            "void f3() { for (auto c : \"abc\") { c; } }";
+        ASSERT_EQUALS("double", typeOf(code, "* 2", "test.cpp", &s));
+        ASSERT_EQUALS("signed long", typeOf(code, "+", "test.cpp", &s));
+        ASSERT_EQUALS("signed char", typeOf(code, "c ;", "test.cpp", &s));
+    }
+
     void valuetype() {
         // stringification
         ASSERT_EQUALS("", ValueType().str());
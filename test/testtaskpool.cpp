@@ -0,0 +1,75 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2018 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "taskpool.h"
+#include "testsuite.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class TestTaskPool : public TestFixture {
+public:
+    TestTaskPool() : TestFixture("TestTaskPool") {
+    }
+
+private:
+
+    void run() override {
+        TEST_CASE(allTasksAreRun);
+        TEST_CASE(firstExceptionIsRethrown);
+    }
+
+    void allTasksAreRun() const {
+        for (unsigned int threads = 1; threads <= 4; ++threads) {
+            std::vector<int> result(20, 0);
+            std::vector<TaskPool::Task> tasks;
+            for (std::size_t i = 0; i < result.size(); ++i) {
+                int *r = &result[i];
+                tasks.push_back([=]() {
+                    *r = (int)i + 1;
+                });
+            }
+            TaskPool::run(threads, tasks);
+            for (std::size_t i = 0; i < result.size(); ++i)
+                ASSERT_EQUALS((int)i + 1, result[i]);
+        }
+    }
+
+    void firstExceptionIsRethrown() const {
+        for (unsigned int threads = 1; threads <= 4; ++threads) {
+            std::vector<TaskPool::Task> tasks;
+            tasks.push_back([]() {});
+            tasks.push_back([]() {
+                throw std::runtime_error("task 1");
+            });
+            tasks.push_back([]() {
+                throw std::runtime_error("task 2");
+            });
+            std::string what;
+            try {
+                TaskPool::run(threads, tasks);
+            } catch (const std::runtime_error &e) {
+                what = e.what();
+            }
+            ASSERT_EQUALS("task 1", what);
+        }
+    }
+};
+
+REGISTER_TEST(TestTaskPool)
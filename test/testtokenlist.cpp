@@ -36,6 +36,8 @@ private:
         TEST_CASE(testaddtoken1);
         TEST_CASE(testaddtoken2);
         TEST_CASE(inc);
+        TEST_CASE(summarizeNames);
+        TEST_CASE(summarizeManyNames);
     }
 
     // inspired by #5895
@@ -73,6 +75,44 @@ private:
 
         ASSERT(Token::simpleMatch(tokenlist.front(), "a + + 1 ; 1 + + b ;"));
     }
+
+    void summarizeNames() const {
+        const char code[] = "void f() { va_list ap; va_start(ap, x); }";
+
+        TokenList tokenlist(&settings);
+        std::istringstream istr(code);
+        tokenlist.createTokens(istr, "a.cpp");
+
+        // Nothing is known before the names are summarized
+        ASSERT_EQUALS(true, tokenlist.mayContainName("BOOST_FOREACH"));
+
+        tokenlist.summarizeNames();
+        ASSERT_EQUALS(true, tokenlist.mayContainName("va_start"));
+        ASSERT_EQUALS(true, tokenlist.mayContainName("va_list"));
+        ASSERT_EQUALS(true, tokenlist.mayContainName("x"));
+        ASSERT_EQUALS(false, tokenlist.mayContainName("BOOST_FOREACH"));
+        ASSERT_EQUALS(false, tokenlist.mayContainName("printf"));
+    }
+
+    void summarizeManyNames() const {
+        // The filter is sized by the number of names, few of the names that are not used pass it
+        std::ostringstream code;
+        for (int i = 0; i < 10000; ++i)
+            code << "int used" << i << ";\n";
+
+        TokenList tokenlist(&settings);
+        std::istringstream istr(code.str());
+        tokenlist.createTokens(istr, "a.cpp");
+        tokenlist.summarizeNames();
+
+        int passed = 0;
+        for (int i = 0; i < 10000; ++i) {
+            ASSERT_EQUALS(true, tokenlist.mayContainName("used" + std::to_string(i)));
+            if (tokenlist.mayContainName("unused" + std::to_string(i)))
+                ++passed;
+        }
+        ASSERT(passed < 500);
+    }
 };
 
 REGISTER_TEST(TestTokenList)
@@ -69,6 +69,8 @@ private:
         TEST_CASE(uninitvar8); // ticket #6230
         TEST_CASE(uninitvar9); // ticket #6424
         TEST_CASE(uninitvar_unconditionalTry);
+        TEST_CASE(uninitvar_initializedBeforeUse); // all variables are tracked in one pass
+        TEST_CASE(uninitvar_initializedForLoopVariable);
         TEST_CASE(uninitvar_funcptr); // #6404
         TEST_CASE(uninitvar_operator); // #6680
         TEST_CASE(uninitvar_ternaryexpression); // #4683
@@ -96,8 +98,6 @@ private:
         std::istringstream istr(code);
         tokenizer.tokenize(istr, fname);
 
-        tokenizer.simplifyTokenList2();
-
         // Check for redundant code..
         CheckUninitVar checkuninitvar(&tokenizer, &settings, this);
         checkuninitvar.check();
@@ -316,13 +316,13 @@ private:
                        "    int b = 1;\n"
                        "    (b += a) = 1;\n"
                        "}");
-        TODO_ASSERT_EQUALS("[test.cpp:4]: (error) Uninitialized variable: a\n","", errout.str());
+        ASSERT_EQUALS("[test.cpp:4]: (error) Uninitialized variable: a\n", errout.str());
 
         checkUninitVar("int f() {\n"
                        "    int a,b,c;\n"
                        "    a = b = c;\n"
                        "}", "test.cpp", /*verify=*/ false);
-        TODO_ASSERT_EQUALS("[test.cpp:3]: (error) Uninitialized variable: c\n", "", errout.str());
+        ASSERT_EQUALS("[test.cpp:3]: (error) Uninitialized variable: c\n", errout.str());
 
         checkUninitVar("static void foo()\n"
                        "{\n"
@@ -2660,6 +2660,88 @@ private:
         ASSERT_EQUALS("[test.cpp:4]: (error) Uninitialized variable: i\n", errout.str());
     }
 
+    void uninitvar_initializedBeforeUse() {
+        checkUninitVar("int f(int c) {\n"
+                       "    int a, b, x;\n"
+                       "    a = c;\n"
+                       "    b = a + 1;\n"
+                       "    return a + b + x;\n"
+                       "}");
+        ASSERT_EQUALS("[test.cpp:5]: (error) Uninitialized variable: x\n", errout.str());
+
+        checkUninitVar("int f(int c) {\n"
+                       "    int x;\n"
+                       "    if (c)\n"
+                       "        x = 1;\n"
+                       "    else\n"
+                       "        x = 2;\n"
+                       "    return x;\n"
+                       "}");
+        ASSERT_EQUALS("", errout.str());
+
+        checkUninitVar("int f(int c) {\n"
+                       "    int x;\n"
+                       "    if (c)\n"
+                       "        x = 1;\n"
+                       "    return x;\n"
+                       "}");
+        ASSERT_EQUALS("[test.cpp:5]: (error) Uninitialized variable: x\n", errout.str());
+
+        checkUninitVar("void f(int c) {\n"
+                       "    for (int i = 0; i < c; i++) {\n"
+                       "        int x;\n"
+                       "        if (i == 0)\n"
+                       "            x = 1;\n"
+                       "        a[i] = x;\n"
+                       "    }\n"
+                       "}");
+        ASSERT_EQUALS("[test.cpp:6]: (error) Uninitialized variable: x\n", errout.str());
+
+        checkUninitVar("int f() {\n"
+                       "    int x;\n"
+                       "    x = x + 1;\n"
+                       "    return x;\n"
+                       "}");
+        ASSERT_EQUALS("[test.cpp:3]: (error) Uninitialized variable: x\n", errout.str());
+
+        checkUninitVar("void f() {\n"
+                       "    char *p;\n"
+                       "    p = malloc(10);\n"
+                       "    return *p;\n"
+                       "}");
+        ASSERT_EQUALS("[test.cpp:4]: (error) Memory is allocated but not initialized: p\n", errout.str());
+    }
+
+    bool isInitializedBeforeUse(const char code[], const char varname[]) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+
+        CheckUninitVar checkuninitvar(&tokenizer, &settings, this);
+        std::vector<bool> initialized;
+        checkuninitvar.getInitializedVariables(&initialized);
+
+        const Token *vartok = tokenizer.tokens();
+        while (vartok && (vartok->str() != varname || !vartok->varId()))
+            vartok = vartok->next();
+        return vartok && initialized[vartok->varId()];
+    }
+
+    void uninitvar_initializedForLoopVariable() {
+        ASSERT_EQUALS(true, isInitializedBeforeUse("void f(int c) {\n"
+                      "    for (int i = 0; i < c; i++)\n"
+                      "        a[i] = 0;\n"
+                      "}", "i"));
+        ASSERT_EQUALS(true, isInitializedBeforeUse("void f(std::vector<int> &v) {\n"
+                      "    for (int x : v)\n"
+                      "        g(x);\n"
+                      "}", "x"));
+        ASSERT_EQUALS(false, isInitializedBeforeUse("void f(int c) {\n"
+                      "    for (int i; i < c; i++)\n"
+                      "        a[i] = 0;\n"
+                      "}", "i"));
+    }
+
     void uninitvar_funcptr() {
         checkUninitVar("void getLibraryContainer() {\n"
                        "    Reference< XStorageBasedLibraryContainer >(*Factory)(const Reference< XComponentContext >&, const Reference< XStorageBasedDocument >&)\n"
@@ -2674,7 +2756,7 @@ private:
                        "        = x;\n"
                        "    rxContainer.set((*Factory)(m_aContext, xDocument));\n"
                        "}", "test.cpp", false);
-        ASSERT_EQUALS("[test.cpp:5]: (error) Uninitialized variable: x\n", errout.str());
+        ASSERT_EQUALS("[test.cpp:4]: (error) Uninitialized variable: x\n", errout.str());
 
         checkUninitVar("void getLibraryContainer() {\n"
                        "    Reference< XStorageBasedLibraryContainer >(*Factory)(const Reference< XComponentContext >&, const Reference< XStorageBasedDocument >&);\n"
@@ -3848,7 +3930,7 @@ private:
                        "  dp=(char *)d; \n"
                        "  init(dp); \n"
                        "}", "test.c");
-        TODO_ASSERT_EQUALS("", "[test.c:4]: (error) Uninitialized variable: d\n", errout.str());
+        ASSERT_EQUALS("", errout.str());
     }
 
 
@@ -3860,7 +3942,6 @@ private:
         Tokenizer tokenizer(&settings, this);
         std::istringstream istr(code);
         tokenizer.tokenize(istr, "test.cpp");
-        tokenizer.simplifyTokenList2();
 
         // Check code..
         CheckUninitVar check(&tokenizer, &settings, this);
@@ -3879,8 +3960,6 @@ private:
         std::istringstream istr(code);
         tokenizer.tokenize(istr, "test.cpp");
 
-        tokenizer.simplifyTokenList2();
-
         // Check for redundant code..
         CheckUninitVar checkuninitvar(&tokenizer, &settings, this);
         checkuninitvar.valueFlowUninit();
@@ -16,12 +16,17 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "analyzerinfo.h"
 #include "checkunusedfunctions.h"
+#include "mathlib.h"
 #include "platform.h"
 #include "settings.h"
+#include "summaries.h"
 #include "testsuite.h"
+#include "testutils.h"
 #include "tokenize.h"
 
+#include <list>
 #include <ostream>
 #include <string>
 
@@ -64,6 +69,8 @@ private:
         TEST_CASE(ignore_declaration); // ignore declaration
 
         TEST_CASE(operatorOverload);
+
+        TEST_CASE(analyzerInfo); // whole program analysis with a build dir
     }
 
     void check(const char code[], Settings::PlatformType platform = Settings::Native) {
@@ -397,6 +404,40 @@ private:
                       "[test.cpp:1]: (style) The function 'foo' is never used.\n", errout.str());
     }
 
+    void analyzerInfo() {
+        TemporaryBuildDir buildDir("testunusedfunctions.dir");
+        const Summaries summaries;
+        const char * const code[] = {
+            "void f() { }\n"
+            "void g() { h(); }\n",
+            "void h() { }\n"
+            "\n\n\n\n\n\n\n\n\n\n"
+            "int operator==(S a, S b) { return 0; }\n"
+            "void k() { g(); }"
+        };
+
+        // the declarations and calls of each file are saved in the build dir
+        for (int i = 0; i < 2; ++i) {
+            const std::string filename = "test" + MathLib::toString(i + 1) + ".cpp";
+            Tokenizer tokenizer(&settings, this);
+            std::istringstream istr(code[i]);
+            tokenizer.tokenize(istr, filename.c_str());
+
+            CheckUnusedFunctions c(&tokenizer, &settings, this);
+            c.parseTokens(tokenizer, filename.c_str(), &settings);
+            std::list<ErrorLogger::ErrorMessage> errors;
+            AnalyzerInformation analyzerInformation;
+            analyzerInformation.analyzeFile(buildDir.path, filename, emptyString, 1U, summaries, &errors);
+            analyzerInformation.setFileInfo("CheckUnusedFunctions", c.analyzerInfo());
+            analyzerInformation.close();
+        }
+
+        errout.str("");
+        CheckUnusedFunctions::analyseWholeProgram(this, buildDir.path);
+        ASSERT_EQUALS("[test1.cpp:1]: (style) The function 'f' is never used.\n"
+                      "[test2.cpp:13]: (style) The function 'k' is never used.\n", errout.str());
+    }
+
     void ignore_declaration() {
         check("void f();\n"
               "void f() {}");
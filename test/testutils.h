@@ -22,6 +22,18 @@
 #include "settings.h"
 #include "tokenize.h"
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
 class Token;
 
 class givenACodeSampleToTokenize {
@@ -62,4 +74,48 @@ private:
     ErrorLogger *_next;
 };
 
+/** Build dir in the current directory that is removed with the files in it when it goes out of scope */
+class TemporaryBuildDir {
+public:
+    explicit TemporaryBuildDir(const std::string &name) : path(name) {
+#ifdef _WIN32
+        _mkdir(path.c_str());
+#else
+        mkdir(path.c_str(), 0755);
+#endif
+        clear();
+    }
+
+    ~TemporaryBuildDir() {
+        clear();
+#ifdef _WIN32
+        _rmdir(path.c_str());
+#else
+        rmdir(path.c_str());
+#endif
+    }
+
+    /** Write a file in the build dir and return its path */
+    std::string write(const std::string &name, const std::string &data) {
+        const std::string filename = path + '/' + name;
+        std::ofstream fout(filename, std::ios::binary | std::ios::trunc);
+        fout << data;
+        mFiles.push_back(name);
+        return filename;
+    }
+
+    const std::string path;
+
+private:
+    void clear() const {
+        const char * const storeFiles[] = { "analyzerinfo.dat", "analyzerinfo.dat.tmp", "analyzerinfo.idx", "analyzerinfo.idx.tmp", "analyzerinfo.lock" };
+        for (const char *name : storeFiles)
+            std::remove((path + '/' + name).c_str());
+        for (const std::string &name : mFiles)
+            std::remove((path + '/' + name).c_str());
+    }
+
+    std::vector<std::string> mFiles;
+};
+
 #endif // TestUtilsH
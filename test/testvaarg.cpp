@@ -41,7 +41,7 @@ private:
 
         // Check..
         CheckVaarg checkVaarg(&tokenizer, &settings, this);
-        checkVaarg.runSimplifiedChecks(&tokenizer, &settings, this);
+        checkVaarg.runChecks(&tokenizer, &settings, this);
     }
 
     void run() override {
@@ -26,7 +26,6 @@
 
 #include <simplecpp.h>
 #include <cmath>
-#include <list>
 #include <map>
 #include <ostream>
 #include <string>
@@ -42,11 +41,12 @@ private:
     Settings settings;
 
     void run() override {
-        // strcpy, abort cfg
+        // strcpy, abort, uint16_t cfg
         const char cfg[] = "<?xml version=\"1.0\"?>\n"
                            "<def>\n"
                            "  <function name=\"strcpy\"> <arg nr=\"1\"><not-null/></arg> </function>\n"
                            "  <function name=\"abort\"> <noreturn>true</noreturn> </function>\n" // abort is a noreturn function
+                           "  <podtype name=\"uint16_t\" sign=\"u\" size=\"2\"/>\n"
                            "</def>";
         settings.library.loadxmldata(cfg, sizeof(cfg));
 
@@ -106,6 +106,11 @@ private:
         TEST_CASE(valueFlowUninit);
 
         TEST_CASE(valueFlowContainerSize);
+
+        TEST_CASE(valueFlowThreads);
+        TEST_CASE(valueFlowBudget);
+        TEST_CASE(valueFlowSubFunctionSummary);
+        TEST_CASE(valueFlowAnalyses);
     }
 
     bool testValueOfXKnown(const char code[], unsigned int linenr, int value) {
@@ -126,15 +131,15 @@ private:
         return false;
     }
 
-    bool testValueOfX(const char code[], unsigned int linenr, int value) {
+    bool testValueOfX(const char code[], unsigned int linenr, int value, const Settings *s = nullptr) {
         // Tokenize..
-        Tokenizer tokenizer(&settings, this);
+        Tokenizer tokenizer(s ? s : &settings, this);
         std::istringstream istr(code);
         tokenizer.tokenize(istr, "test.cpp");
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isIntValue() && it->intvalue == value)
                         return true;
@@ -153,7 +158,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isFloatValue() && it->floatValue >= value - diff && it->floatValue <= value + diff)
                         return true;
@@ -175,7 +180,7 @@ private:
                 continue;
 
             std::ostringstream ostr;
-            std::list<ValueFlow::Value>::const_iterator it;
+            std::vector<ValueFlow::Value>::const_iterator it;
             for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                 for (ValueFlow::Value::ErrorPath::const_iterator ep = it->errorPath.begin(); ep != it->errorPath.end(); ++ep) {
                     const Token *eptok = ep->first;
@@ -197,7 +202,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isTokValue() && Token::simpleMatch(it->tokvalue, value))
                         return true;
@@ -216,7 +221,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isMovedValue() && it->moveKind == moveKind)
                         return true;
@@ -235,7 +240,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isIntValue() && it->intvalue == value && it->condition)
                         return true;
@@ -246,8 +251,9 @@ private:
         return false;
     }
 
-    void bailout(const char code[]) {
-        settings.debugwarnings = true;
+    void bailout(const char code[], const Settings *s = nullptr) {
+        Settings settings1(s ? *s : settings);
+        settings1.debugwarnings = true;
         errout.str("");
 
         std::vector<std::string> files(1, "test.cpp");
@@ -259,24 +265,22 @@ private:
         simplecpp::preprocess(tokens2, tokens1, files, filedata, simplecpp::DUI());
 
         // Tokenize..
-        Tokenizer tokenizer(&settings, this);
+        Tokenizer tokenizer(&settings1, this);
         tokenizer.createTokens(&tokens2);
         tokenizer.simplifyTokens1("");
-
-        settings.debugwarnings = false;
     }
 
-    std::list<ValueFlow::Value> tokenValues(const char code[], const char tokstr[]) {
+    std::vector<ValueFlow::Value> tokenValues(const char code[], const char tokstr[]) {
         Tokenizer tokenizer(&settings, this);
         std::istringstream istr(code);
         errout.str("");
         tokenizer.tokenize(istr, "test.cpp");
         const Token *tok = Token::findmatch(tokenizer.tokens(), tokstr);
-        return tok ? tok->values() : std::list<ValueFlow::Value>();
+        return tok ? tok->values() : std::vector<ValueFlow::Value>();
     }
 
     ValueFlow::Value valueOfTok(const char code[], const char tokstr[]) {
-        std::list<ValueFlow::Value> values = tokenValues(code, tokstr);
+        std::vector<ValueFlow::Value> values = tokenValues(code, tokstr);
         return values.size() == 1U && !values.front().isTokValue() ? values.front() : ValueFlow::Value();
     }
 
@@ -513,7 +517,7 @@ private:
                 "    if (x==2) {}\n"
                 "    if (x==4) {}\n"
                 "}";
-        std::list<ValueFlow::Value> values = tokenValues(code,"*");
+        std::vector<ValueFlow::Value> values = tokenValues(code,"*");
         ASSERT_EQUALS(2U, values.size());
         ASSERT_EQUALS(4, values.front().intvalue);
         ASSERT_EQUALS(16, values.back().intvalue);
@@ -678,7 +682,7 @@ private:
 
     void valueFlowSizeof() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
 #define CHECK(A, B)                              \
         code = "void f() {\n"                    \
@@ -705,6 +709,15 @@ private:
         ASSERT_EQUALS(1U, values.size());
         ASSERT_EQUALS(10, values.back().intvalue);
 
+        // array of library pod type
+        code  = "void f() {\n"
+                "    uint16_t a[10];"
+                "    x = sizeof(a);\n"
+                "}";
+        values = tokenValues(code,"( a )");
+        ASSERT_EQUALS(1U, values.size());
+        ASSERT_EQUALS(20, values.back().intvalue);
+
 #define CHECK(A, B, C, D)                         \
         code = "enum " A " E " B " { E0, E1 };\n" \
                "void f() {\n"                     \
@@ -2742,8 +2755,8 @@ private:
     }
 
     bool isNotKnownValues(const char code[], const char str[]) {
-        const std::list<ValueFlow::Value> values = tokenValues(code, str);
-        for (std::list<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
+        const std::vector<ValueFlow::Value> values = tokenValues(code, str);
+        for (std::vector<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
             if (it->isKnown())
                 return false;
         }
@@ -3116,7 +3129,7 @@ private:
 
     void valueFlowUninit() {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        std::vector<ValueFlow::Value> values;
 
         code = "void f() {\n"
                "    int x;\n"
@@ -3245,7 +3258,7 @@ private:
         ASSERT_EQUALS(true, values.front().intvalue == 0 || values.back().intvalue == 0);
     }
 
-    static std::string isPossibleContainerSizeValue(const std::list<ValueFlow::Value> &values, MathLib::bigint i) {
+    static std::string isPossibleContainerSizeValue(const std::vector<ValueFlow::Value> &values, MathLib::bigint i) {
         if (values.size() != 1)
             return "values.size():" + std::to_string(values.size());
         if (!values.front().isContainerSizeValue())
@@ -3257,7 +3270,7 @@ private:
         return "";
     }
 
-    static std::string isKnownContainerSizeValue(const std::list<ValueFlow::Value> &values, MathLib::bigint i) {
+    static std::string isKnownContainerSizeValue(const std::vector<ValueFlow::Value> &values, MathLib::bigint i) {
         if (values.size() != 1)
             return "values.size():" + std::to_string(values.size());
         if (!values.front().isContainerSizeValue())
@@ -3367,6 +3380,122 @@ private:
         ASSERT(tokenValues(code, "ints [").empty());
 
     }
+
+    std::string allValues(const char code[], unsigned int threads) {
+        Settings s(settings);
+        s.threads = threads;
+        Tokenizer tokenizer(&s, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+
+        std::ostringstream ret;
+        for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
+            for (const ValueFlow::Value &value : tok->values())
+                ret << tok->linenr() << ':' << tok->str() << '=' << value.infoString() << (value.isKnown() ? "k" : "p") << ' ';
+        }
+        return ret.str();
+    }
+
+    void valueFlowThreads() {
+        const char code[] = "int f1(int x) {\n"
+                            "  int a = x + 1;\n"
+                            "  if (x == 3) {}\n"
+                            "  return a;\n"
+                            "}\n"
+                            "int f2(int y) {\n"
+                            "  struct S { int g() { int b = 4; return b; } };\n"
+                            "  int c = 2;\n"
+                            "  if (y < 10) c = y;\n"
+                            "  return c + f1(5);\n"
+                            "}\n"
+                            "void f3(int *p) {\n"
+                            "  *p = 0;\n"
+                            "  if (p) {}\n"
+                            "}";
+        const std::string serial = allValues(code, 1);
+        ASSERT(serial.find("2:x=3p") != std::string::npos);
+        ASSERT(serial.find("7:b=4k") != std::string::npos);
+        ASSERT_EQUALS(serial, allValues(code, 4));
+    }
+
+    void valueFlowBudget() {
+        const char code[] = "int f(int x) {\n"
+                            "  return x;\n"
+                            "}\n"
+                            "void g() {\n"
+                            "  f(1); f(2); f(3); f(4); f(5); f(6);\n"
+                            "  f(7); f(8); f(9); f(10); f(11); f(12);\n"
+                            "}";
+
+        // values beyond the token budget are dropped
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 1));
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 10));
+        ASSERT_EQUALS(false, testValueOfX(code, 2U, 11));
+        ASSERT_EQUALS(false, testValueOfX(code, 2U, 12));
+        bailout(code);
+        ASSERT(errout.str().find("value budget of token 'x' is exceeded") != std::string::npos);
+
+        // the values that are kept are not replaced by later values
+        const char code2[] = "int f(int x) {\n"
+                             "  return 100 / x;\n"
+                             "}\n"
+                             "void g() {\n"
+                             "  f(0); f(1); f(2); f(3); f(4); f(5); f(6); f(7); f(8); f(9);\n"
+                             "  f(-1); f(100);\n"
+                             "}";
+        ASSERT_EQUALS(true, testValueOfX(code2, 2U, 0));
+        ASSERT_EQUALS(true, testValueOfX(code2, 2U, 9));
+        ASSERT_EQUALS(false, testValueOfX(code2, 2U, -1));
+
+        // function budget
+        Settings s(settings);
+        s.valueFlowMaxFunctionValues = 5;
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 5, &s));
+        ASSERT_EQUALS(false, testValueOfX(code, 2U, 6, &s));
+        bailout(code, &s);
+        ASSERT(errout.str().find("value budget of function 'f' is exceeded") != std::string::npos);
+    }
+
+    void valueFlowAnalyses() {
+        const char code[] = "void f(std::vector<int> v) {\n"
+                            "  v[10] = 0;\n"
+                            "  if (v.size() == 10) {}\n"
+                            "}";
+
+        LOAD_LIB_2(settings.library, "std.cfg");
+
+        // container sizes are only calculated when some check needs them
+        settings.valueFlowAnalyses = ~0U;
+        ASSERT_EQUALS("", isPossibleContainerSizeValue(tokenValues(code, "v ["), 10));
+        settings.valueFlowAnalyses = ~0U & ~ValueFlow::ANALYSIS_CONTAINER_SIZE;
+        ASSERT(tokenValues(code, "v [").empty());
+        settings.valueFlowAnalyses = ~0U;
+    }
+
+    void valueFlowSubFunctionSummary() {
+        // the same values are only passed once into the function
+        const char code[] = "int f(int x) {\n"
+                            "  return x;\n"
+                            "}\n"
+                            "void g() {\n"
+                            "  f(1); f(1); f(1); f(1); f(1); f(1);\n"
+                            "  f(2);\n"
+                            "}";
+        settings.valueFlowMaxFunctionValues = 2;
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 1));
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 2));
+        settings.valueFlowMaxFunctionValues = 1000;
+        ASSERT_EQUALS("5,Calling function 'f', 1st argument 'x' value is 1\n"
+                      "6,Calling function 'f', 1st argument 'x' value is 2\n", getErrorPathForX(code, 2U));
+
+        // the return value is calculated once for each argument value
+        const char code2[] = "int f(int a) { return a * 2; }\n"
+                             "int g() {\n"
+                             "  int x = f(3) + f(3);\n"
+                             "  return x;\n"
+                             "}";
+        ASSERT_EQUALS(true, testValueOfX(code2, 4U, 12));
+    }
 };
 
 REGISTER_TEST(TestValueFlow)
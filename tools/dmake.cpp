@@ -257,6 +257,8 @@ int main(int argc, char **argv)
          << "        endif # !CPPCHK_GLIBCXX_DEBUG\n"
          << "    endif # GNU/kFreeBSD\n"
          << "\n"
+         << "    LIBS += -pthread\n"
+         << "\n"
          << "endif # COMSPEC\n"
          << "\n";
 